@@ -1131,6 +1131,14 @@ static void gdextension_object_method_bind_ptrcall(GDExtensionMethodBindPtr p_me
 	mb->ptrcall(o, (const void **)p_args, p_ret);
 }
 
+static void gdextension_object_method_bind_ptrcall_batch(GDExtensionMethodBindPtr p_method_bind, const GDExtensionObjectPtr *p_instances, const GDExtensionConstTypePtr *const *p_args, const GDExtensionTypePtr *r_rets, GDExtensionInt p_count) {
+	const MethodBind *mb = reinterpret_cast<const MethodBind *>(p_method_bind);
+	ERR_FAIL_COND_MSG(r_rets == nullptr && mb->has_return(), "Return value pointers are required to call a method that returns a value.");
+	for (GDExtensionInt i = 0; i < p_count; i++) {
+		mb->ptrcall((Object *)p_instances[i], (const void **)p_args[i], r_rets ? r_rets[i] : nullptr);
+	}
+}
+
 static void gdextension_object_destroy(GDExtensionObjectPtr p_o) {
 	memdelete((Object *)p_o);
 }
@@ -1490,6 +1498,7 @@ void gdextension_setup_interface() {
 	REGISTER_INTERFACE_FUNC(dictionary_operator_index_const);
 	REGISTER_INTERFACE_FUNC(object_method_bind_call);
 	REGISTER_INTERFACE_FUNC(object_method_bind_ptrcall);
+	REGISTER_INTERFACE_FUNC(object_method_bind_ptrcall_batch);
 	REGISTER_INTERFACE_FUNC(object_destroy);
 	REGISTER_INTERFACE_FUNC(global_get_singleton);
 	REGISTER_INTERFACE_FUNC(object_get_instance_binding);
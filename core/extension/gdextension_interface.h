@@ -2145,6 +2145,20 @@ typedef void (*GDExtensionInterfaceObjectMethodBindCall)(GDExtensionMethodBindPt
  */
 typedef void (*GDExtensionInterfaceObjectMethodBindPtrcall)(GDExtensionMethodBindPtr p_method_bind, GDExtensionObjectPtr p_instance, const GDExtensionConstTypePtr *p_args, GDExtensionTypePtr r_ret);
 
+/**
+ * @name object_method_bind_ptrcall_batch
+ * @since 4.3
+ *
+ * Calls the same method on several Objects (using a "ptrcall"), with a single call through the interface.
+ *
+ * @param p_method_bind A pointer to the MethodBind representing the method on the Objects' class.
+ * @param p_instances A pointer to a C array of the Objects to call the method on.
+ * @param p_args A pointer to a C array with, for each Object, a pointer to a C array representing its arguments. The same pointer can be repeated to pass the same arguments to every Object.
+ * @param r_rets A pointer to a C array with, for each Object, a pointer that will receive the return value. Can be NULL if the method doesn't return a value.
+ * @param p_count The number of Objects.
+ */
+typedef void (*GDExtensionInterfaceObjectMethodBindPtrcallBatch)(GDExtensionMethodBindPtr p_method_bind, const GDExtensionObjectPtr *p_instances, const GDExtensionConstTypePtr *const *p_args, const GDExtensionTypePtr *r_rets, GDExtensionInt p_count);
+
 /**
  * @name object_destroy
  * @since 4.1
@@ -52,6 +52,117 @@ void FileAccessCompressed::configure(const String &p_magic, Compression::Mode p_
 		}                                                   \
 	}
 
+bool FileAccessCompressed::_decompress_block(Compression::Mode p_mode, uint32_t p_block_size, const uint8_t *p_src, uint32_t p_src_size, Vector<uint8_t> &r_dst) {
+	// Some modes pad small blocks when compressing, so always leave room for a full block.
+	r_dst.resize(p_block_size);
+	return Compression::decompress(r_dst.ptrw(), p_block_size, p_src, p_src_size, p_mode) != -1;
+}
+
+void FileAccessCompressed::_compress_block(void *p_userdata, uint32_t p_index) {
+	CompressBlocks *data = (CompressBlocks *)p_userdata;
+	uint32_t bl = p_index == (data->block_count - 1) ? data->total % data->block_size : data->block_size;
+	const uint8_t *bp = &data->src[uint64_t(p_index) * data->block_size];
+
+	Vector<uint8_t> &cblock = data->compressed[p_index];
+	cblock.resize(Compression::get_max_compressed_buffer_size(bl, data->mode));
+	int s = Compression::compress(cblock.ptrw(), bp, bl, data->mode);
+	cblock.resize(MAX(s, 0));
+}
+
+void FileAccessCompressed::_read_ahead_decompress(void *p_userdata) {
+	ReadAhead *ra = (ReadAhead *)p_userdata;
+	for (uint32_t i = 0; i < ra->compressed.size(); i++) {
+		if (!_decompress_block(ra->mode, ra->block_size, ra->compressed[i].ptr(), ra->compressed[i].size(), ra->decompressed[i])) {
+			// Leave corrupted blocks to the synchronous path, which reports the error.
+			ra->decompressed.resize(i);
+			break;
+		}
+	}
+}
+
+void FileAccessCompressed::_start_read_ahead(uint32_t p_block) const {
+	uint32_t count = MIN(read_ahead_blocks, read_block_count - p_block);
+	if (count == 0) {
+		return;
+	}
+
+	read_ahead.mode = cmode;
+	read_ahead.block_size = block_size;
+	read_ahead.first_block = p_block;
+	read_ahead.compressed.resize(count);
+	read_ahead.decompressed.resize(count);
+
+	// FileAccess is not thread-safe, so only decompression happens in the background.
+	f->seek(read_blocks[p_block].offset);
+	for (uint32_t i = 0; i < count; i++) {
+		Vector<uint8_t> &cblock = read_ahead.compressed[i];
+		cblock.resize(read_blocks[p_block + i].csize);
+		f->get_buffer(cblock.ptrw(), cblock.size());
+	}
+
+	read_ahead_task = WorkerThreadPool::get_singleton()->add_native_task(&FileAccessCompressed::_read_ahead_decompress, &read_ahead, false, SNAME("FileAccessCompressedReadAhead"));
+}
+
+void FileAccessCompressed::_finish_read_ahead() const {
+	if (read_ahead_task == WorkerThreadPool::INVALID_TASK_ID) {
+		return;
+	}
+
+	WorkerThreadPool::get_singleton()->wait_for_task_completion(read_ahead_task);
+	read_ahead_task = WorkerThreadPool::INVALID_TASK_ID;
+
+	for (uint32_t i = 0; i < read_ahead.decompressed.size(); i++) {
+		block_cache.insert(read_ahead.first_block + i, read_ahead.decompressed[i]);
+	}
+	read_ahead.compressed.clear();
+	read_ahead.decompressed.clear();
+}
+
+bool FileAccessCompressed::_load_block(uint32_t p_block, bool p_sequential) const {
+	ERR_FAIL_UNSIGNED_INDEX_V(p_block, read_block_count, false);
+
+	if (read_ahead_task != WorkerThreadPool::INVALID_TASK_ID) {
+		// Only keep decompressing in the background while the reader is heading towards the blocks.
+		// Otherwise it's finished, so the next sequential read can start a new one, and its blocks stay cached in case the reader seeks back.
+		bool heading_towards = p_block < read_ahead.first_block && read_ahead.first_block - p_block <= read_ahead_blocks;
+		if (!heading_towards) {
+			_finish_read_ahead();
+		}
+	}
+
+	const Vector<uint8_t> *cached = block_cache.getptr(p_block);
+	if (cached) {
+		read_data = *cached;
+	} else {
+		const ReadBlock &rb = read_blocks[p_block];
+		f->seek(rb.offset);
+		f->get_buffer(comp_buffer.ptrw(), rb.csize);
+		Vector<uint8_t> data;
+		if (!_decompress_block(cmode, block_size, comp_buffer.ptr(), rb.csize, data)) {
+			return false;
+		}
+		block_cache.insert(p_block, data);
+		read_data = data;
+	}
+
+	read_ptr = read_data.ptr();
+	read_block = p_block;
+	read_block_size = _get_block_size(p_block);
+
+	if (p_sequential && read_ahead_blocks > 0 && read_ahead_task == WorkerThreadPool::INVALID_TASK_ID) {
+		// Keep the next `read_ahead_blocks` blocks decompressed ahead of the reader.
+		uint32_t last = MIN(p_block + read_ahead_blocks, read_block_count - 1);
+		for (uint32_t i = p_block + 1; i <= last; i++) {
+			if (!block_cache.has(i)) {
+				_start_read_ahead(i);
+				break;
+			}
+		}
+	}
+
+	return true;
+}
+
 Error FileAccessCompressed::open_after_magic(Ref<FileAccess> p_base) {
 	f = p_base;
 	cmode = (Compression::Mode)f->get_32();
@@ -74,19 +185,19 @@ Error FileAccessCompressed::open_after_magic(Ref<FileAccess> p_base) {
 	}
 
 	comp_buffer.resize(max_bs);
-	buffer.resize(block_size);
-	read_ptr = buffer.ptrw();
-	f->get_buffer(comp_buffer.ptrw(), read_blocks[0].csize);
-	at_end = false;
+	at_end = read_total == 0;
 	read_eof = false;
 	read_block_count = bc;
-	read_block_size = read_blocks.size() == 1 ? read_total : block_size;
 
-	int ret = Compression::decompress(buffer.ptrw(), read_block_size, comp_buffer.ptr(), read_blocks[0].csize, cmode);
-	read_block = 0;
+	// Read ahead about 64 KiB, and cache enough blocks to hold it twice over.
+	read_ahead_blocks = WorkerThreadPool::get_singleton()->get_thread_count() > 0 ? CLAMP(65536 / block_size, 1u, 16u) : 0;
+	block_cache.clear();
+	block_cache.set_capacity(read_ahead_blocks * 2 + 8);
+
+	bool ok = _load_block(0, true);
 	read_pos = 0;
 
-	return ret == -1 ? ERR_FILE_CORRUPT : OK;
+	return ok ? OK : ERR_FILE_CORRUPT;
 }
 
 Error FileAccessCompressed::open_internal(const String &p_path, int p_mode_flags) {
@@ -144,22 +255,29 @@ void FileAccessCompressed::_close() {
 			f->store_32(0); //compressed sizes, will update later
 		}
 
-		Vector<int> block_sizes;
-		for (uint32_t i = 0; i < bc; i++) {
-			uint32_t bl = i == (bc - 1) ? write_max % block_size : block_size;
-			uint8_t *bp = &write_ptr[i * block_size];
-
-			Vector<uint8_t> cblock;
-			cblock.resize(Compression::get_max_compressed_buffer_size(bl, cmode));
-			int s = Compression::compress(cblock.ptrw(), bp, bl, cmode);
+		CompressBlocks data;
+		data.mode = cmode;
+		data.block_size = block_size;
+		data.block_count = bc;
+		data.total = write_max;
+		data.src = write_ptr;
+		data.compressed.resize(bc);
+
+		// Blocks are independent, compress them in parallel.
+		if (bc > 1) {
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&FileAccessCompressed::_compress_block, &data, bc, -1, true, SNAME("FileAccessCompressedBlocks"));
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		} else {
+			_compress_block(&data, 0);
+		}
 
-			f->store_buffer(cblock.ptr(), s);
-			block_sizes.push_back(s);
+		for (uint32_t i = 0; i < bc; i++) {
+			f->store_buffer(data.compressed[i].ptr(), data.compressed[i].size());
 		}
 
 		f->seek(16); //ok write block sizes
 		for (uint32_t i = 0; i < bc; i++) {
-			f->store_32(block_sizes[i]);
+			f->store_32(data.compressed[i].size());
 		}
 		f->seek_end();
 		f->store_buffer((const uint8_t *)mgc.get_data(), mgc.length()); //magic at the end too
@@ -167,6 +285,10 @@ void FileAccessCompressed::_close() {
 		buffer.clear();
 
 	} else {
+		_finish_read_ahead();
+		block_cache.clear();
+		read_data.clear();
+		read_ptr = nullptr;
 		comp_buffer.clear();
 		buffer.clear();
 		read_blocks.clear();
@@ -211,12 +333,7 @@ void FileAccessCompressed::seek(uint64_t p_position) {
 			read_eof = false;
 			uint32_t block_idx = p_position / block_size;
 			if (block_idx != read_block) {
-				read_block = block_idx;
-				f->seek(read_blocks[read_block].offset);
-				f->get_buffer(comp_buffer.ptrw(), read_blocks[read_block].csize);
-				int ret = Compression::decompress(buffer.ptrw(), read_blocks.size() == 1 ? read_total : block_size, comp_buffer.ptr(), read_blocks[read_block].csize, cmode);
-				ERR_FAIL_COND_MSG(ret == -1, "Compressed file is corrupt.");
-				read_block_size = read_block == read_block_count - 1 ? read_total % block_size : block_size;
+				ERR_FAIL_COND_MSG(!_load_block(block_idx, block_idx == read_block + 1), "Compressed file is corrupt.");
 			}
 
 			read_pos = p_position % block_size;
@@ -237,6 +354,8 @@ uint64_t FileAccessCompressed::get_position() const {
 	ERR_FAIL_COND_V_MSG(f.is_null(), 0, "File must be opened before use.");
 	if (writing) {
 		return write_pos;
+	} else if (at_end) {
+		return read_total;
 	} else {
 		return (uint64_t)read_block * block_size + read_pos;
 	}
@@ -273,18 +392,11 @@ uint8_t FileAccessCompressed::get_8() const {
 
 	read_pos++;
 	if (read_pos >= read_block_size) {
-		read_block++;
-
-		if (read_block < read_block_count) {
+		if (_has_next_block()) {
 			//read another block of compressed data
-			f->get_buffer(comp_buffer.ptrw(), read_blocks[read_block].csize);
-			int total = Compression::decompress(buffer.ptrw(), read_blocks.size() == 1 ? read_total : block_size, comp_buffer.ptr(), read_blocks[read_block].csize, cmode);
-			ERR_FAIL_COND_V_MSG(total == -1, 0, "Compressed file is corrupt.");
-			read_block_size = read_block == read_block_count - 1 ? read_total % block_size : block_size;
+			ERR_FAIL_COND_V_MSG(!_load_block(read_block + 1, true), 0, "Compressed file is corrupt.");
 			read_pos = 0;
-
 		} else {
-			read_block--;
 			at_end = true;
 		}
 	}
@@ -302,27 +414,24 @@ uint64_t FileAccessCompressed::get_buffer(uint8_t *p_dst, uint64_t p_length) con
 		return 0;
 	}
 
-	for (uint64_t i = 0; i < p_length; i++) {
-		p_dst[i] = read_ptr[read_pos];
-		read_pos++;
-		if (read_pos >= read_block_size) {
-			read_block++;
+	uint64_t dst_pos = 0;
+	while (dst_pos < p_length) {
+		uint64_t chunk = MIN(p_length - dst_pos, uint64_t(read_block_size - read_pos));
+		memcpy(p_dst + dst_pos, read_ptr + read_pos, chunk);
+		dst_pos += chunk;
+		read_pos += chunk;
 
-			if (read_block < read_block_count) {
+		if (read_pos >= read_block_size) {
+			if (_has_next_block()) {
 				//read another block of compressed data
-				f->get_buffer(comp_buffer.ptrw(), read_blocks[read_block].csize);
-				int ret = Compression::decompress(buffer.ptrw(), read_blocks.size() == 1 ? read_total : block_size, comp_buffer.ptr(), read_blocks[read_block].csize, cmode);
-				ERR_FAIL_COND_V_MSG(ret == -1, -1, "Compressed file is corrupt.");
-				read_block_size = read_block == read_block_count - 1 ? read_total % block_size : block_size;
+				ERR_FAIL_COND_V_MSG(!_load_block(read_block + 1, true), -1, "Compressed file is corrupt.");
 				read_pos = 0;
-
 			} else {
-				read_block--;
 				at_end = true;
-				if (i + 1 < p_length) {
+				if (dst_pos < p_length) {
 					read_eof = true;
 				}
-				return i + 1;
+				return dst_pos;
 			}
 		}
 	}
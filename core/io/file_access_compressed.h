@@ -33,6 +33,9 @@
 
 #include "core/io/compression.h"
 #include "core/io/file_access.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/lru.h"
 
 class FileAccessCompressed : public FileAccess {
 	Compression::Mode cmode = Compression::MODE_ZSTD;
@@ -51,7 +54,7 @@ class FileAccessCompressed : public FileAccess {
 	};
 
 	mutable Vector<uint8_t> comp_buffer;
-	uint8_t *read_ptr = nullptr;
+	mutable const uint8_t *read_ptr = nullptr;
 	mutable uint32_t read_block = 0;
 	uint32_t read_block_count = 0;
 	mutable uint32_t read_block_size = 0;
@@ -59,12 +62,50 @@ class FileAccessCompressed : public FileAccess {
 	Vector<ReadBlock> read_blocks;
 	uint64_t read_total = 0;
 
+	// Decompressed blocks, so seeking back and forth doesn't decompress the same blocks again.
+	// The current block is also referenced by `read_data`, so it stays valid once evicted.
+	mutable LRUCache<uint32_t, Vector<uint8_t>> block_cache;
+	mutable Vector<uint8_t> read_data;
+
+	// Sequential reads decompress the upcoming blocks on the WorkerThreadPool.
+	struct ReadAhead {
+		Compression::Mode mode = Compression::MODE_ZSTD;
+		uint32_t block_size = 0;
+		uint32_t first_block = 0;
+		LocalVector<Vector<uint8_t>> compressed;
+		LocalVector<Vector<uint8_t>> decompressed;
+	};
+	mutable ReadAhead read_ahead;
+	mutable WorkerThreadPool::TaskID read_ahead_task = WorkerThreadPool::INVALID_TASK_ID;
+	uint32_t read_ahead_blocks = 0;
+
+	struct CompressBlocks {
+		Compression::Mode mode = Compression::MODE_ZSTD;
+		uint32_t block_size = 0;
+		uint32_t block_count = 0;
+		uint64_t total = 0;
+		const uint8_t *src = nullptr;
+		LocalVector<Vector<uint8_t>> compressed;
+	};
+
 	String magic = "GCMP";
 	mutable Vector<uint8_t> buffer;
 	Ref<FileAccess> f;
 
+	static bool _decompress_block(Compression::Mode p_mode, uint32_t p_block_size, const uint8_t *p_src, uint32_t p_src_size, Vector<uint8_t> &r_dst);
+	static void _compress_block(void *p_userdata, uint32_t p_index);
+	static void _read_ahead_decompress(void *p_userdata);
+
+	_FORCE_INLINE_ uint32_t _get_block_size(uint32_t p_block) const { return p_block == read_block_count - 1 ? read_total % block_size : block_size; }
+	_FORCE_INLINE_ bool _has_next_block() const { return read_block + 1 < read_block_count && _get_block_size(read_block + 1) > 0; }
+	bool _load_block(uint32_t p_block, bool p_sequential) const;
+	void _start_read_ahead(uint32_t p_block) const;
+	void _finish_read_ahead() const;
+
 	void _close();
 
+	friend class TestFileAccessCompressedInternalsAccessor;
+
 public:
 	void configure(const String &p_magic, Compression::Mode p_mode = Compression::MODE_ZSTD, uint32_t p_block_size = 4096);
 
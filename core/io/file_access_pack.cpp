@@ -30,8 +30,10 @@
 
 #include "file_access_pack.h"
 
+#include "core/io/compression.h"
 #include "core/io/file_access_encrypted.h"
 #include "core/object/script_language.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 #include "core/version.h"
 
@@ -47,7 +49,7 @@ Error PackedData::add_pack(const String &p_path, bool p_replace_files, uint64_t
 	return ERR_FILE_UNRECOGNIZED;
 }
 
-void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted) {
+void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted, bool p_compressed) {
 	String simplified_path = p_path.simplify_path();
 	PathMD5 pmd5(simplified_path.md5_buffer());
 
@@ -55,6 +57,7 @@ void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64
 
 	PackedFile pf;
 	pf.encrypted = p_encrypted;
+	pf.compressed = p_compressed;
 	pf.pack = p_pkg_path;
 	pf.offset = p_ofs;
 	pf.size = p_size;
@@ -102,6 +105,86 @@ void PackedData::add_pack_source(PackSource *p_source) {
 	}
 }
 
+void PackedData::_compress_block(void *p_data, uint32_t p_index) {
+	CompressBlocksData *data = (CompressBlocksData *)p_data;
+	uint64_t from = uint64_t(p_index) * PACK_COMPRESSED_BLOCK_SIZE;
+	int size = MIN(uint64_t(PACK_COMPRESSED_BLOCK_SIZE), data->src_size - from);
+	uint8_t *dst = data->dst + uint64_t(p_index) * data->dst_block_size;
+
+	int compressed_size = Compression::compress(dst, data->src + from, size, Compression::MODE_ZSTD);
+	if (compressed_size < 0 || compressed_size >= size) {
+		// Incompressible data is stored as is, readers detect this by the block not being any smaller.
+		memcpy(dst, data->src + from, size);
+		compressed_size = size;
+	}
+	data->compressed_sizes[p_index] = compressed_size;
+}
+
+Error PackedData::store_compressed(const Ref<FileAccess> &p_dst, const Ref<FileAccess> &p_src, uint64_t p_size) {
+	ERR_FAIL_COND_V(p_dst.is_null() || p_src.is_null(), ERR_INVALID_PARAMETER);
+
+	const uint32_t block_count = (p_size + PACK_COMPRESSED_BLOCK_SIZE - 1) / PACK_COMPRESSED_BLOCK_SIZE;
+
+	p_dst->store_32(PACK_COMPRESSED_BLOCK_SIZE);
+	p_dst->store_32(block_count);
+
+	// Compressed sizes are only known once blocks are done, reserve the table and fill it afterwards.
+	uint64_t table_pos = p_dst->get_position();
+	for (uint32_t i = 0; i < block_count; i++) {
+		p_dst->store_32(0);
+	}
+
+	// Only keep a few blocks per thread in flight, so memory use does not depend on the file size.
+	WorkerThreadPool *wtp = WorkerThreadPool::get_singleton();
+	const uint32_t window = MAX(1, wtp->get_thread_count()) * 4;
+
+	CompressBlocksData data;
+	data.dst_block_size = Compression::get_max_compressed_buffer_size(PACK_COMPRESSED_BLOCK_SIZE, Compression::MODE_ZSTD);
+
+	Vector<uint8_t> src_buffer;
+	src_buffer.resize(uint64_t(MIN(window, block_count)) * PACK_COMPRESSED_BLOCK_SIZE);
+	Vector<uint8_t> dst_buffer;
+	dst_buffer.resize(uint64_t(MIN(window, block_count)) * data.dst_block_size);
+
+	LocalVector<uint32_t> block_sizes;
+	block_sizes.resize(block_count);
+
+	uint64_t remaining = p_size;
+	for (uint32_t first = 0; first < block_count; first += window) {
+		uint32_t count = MIN(window, block_count - first);
+		uint64_t to_read = MIN(remaining, uint64_t(count) * PACK_COMPRESSED_BLOCK_SIZE);
+		uint64_t read = p_src->get_buffer(src_buffer.ptrw(), to_read);
+		ERR_FAIL_COND_V_MSG(read != to_read, ERR_FILE_CANT_READ, "Unexpected end of file while compressing pack entry.");
+		remaining -= read;
+
+		data.src = src_buffer.ptr();
+		data.src_size = read;
+		data.dst = dst_buffer.ptrw();
+		data.compressed_sizes.resize(count);
+
+		if (count > 1) {
+			WorkerThreadPool::GroupID group = wtp->add_native_group_task(&PackedData::_compress_block, &data, count, -1, false, SNAME("PackCompressBlocks"));
+			wtp->wait_for_group_task_completion(group);
+		} else {
+			_compress_block(&data, 0);
+		}
+
+		for (uint32_t i = 0; i < count; i++) {
+			p_dst->store_buffer(data.dst + uint64_t(i) * data.dst_block_size, data.compressed_sizes[i]);
+			block_sizes[first + i] = data.compressed_sizes[i];
+		}
+	}
+
+	uint64_t end_pos = p_dst->get_position();
+	p_dst->seek(table_pos);
+	for (uint32_t i = 0; i < block_count; i++) {
+		p_dst->store_32(block_sizes[i]);
+	}
+	p_dst->seek(end_pos);
+
+	return OK;
+}
+
 PackedData *PackedData::singleton = nullptr;
 
 PackedData::PackedData() {
@@ -201,7 +284,7 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files,
 	uint32_t ver_minor = f->get_32();
 	f->get_32(); // patch number, not used for validation.
 
-	ERR_FAIL_COND_V_MSG(version != PACK_FORMAT_VERSION, false, "Pack version unsupported: " + itos(version) + ".");
+	ERR_FAIL_COND_V_MSG(version < PACK_FORMAT_VERSION_MIN || version > PACK_FORMAT_VERSION, false, "Pack version unsupported: " + itos(version) + ".");
 	ERR_FAIL_COND_V_MSG(ver_major > VERSION_MAJOR || (ver_major == VERSION_MAJOR && ver_minor > VERSION_MINOR), false, "Pack created with a newer version of the engine: " + itos(ver_major) + "." + itos(ver_minor) + ".");
 
 	uint32_t pack_flags = f->get_32();
@@ -248,7 +331,7 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files,
 		f->get_buffer(md5, 16);
 		uint32_t flags = f->get_32();
 
-		PackedData::get_singleton()->add_path(p_path, path, ofs + p_offset, size, md5, this, p_replace_files, (flags & PACK_FILE_ENCRYPTED));
+		PackedData::get_singleton()->add_path(p_path, path, ofs + p_offset, size, md5, this, p_replace_files, (flags & PACK_FILE_ENCRYPTED), (flags & PACK_FILE_COMPRESSED));
 	}
 
 	return true;
@@ -265,6 +348,49 @@ Error FileAccessPack::open_internal(const String &p_path, int p_mode_flags) {
 	return ERR_UNAVAILABLE;
 }
 
+Error FileAccessPack::_parse_compressed_header() {
+	uint32_t block_size = f->get_32();
+	ERR_FAIL_COND_V_MSG(block_size != PACK_COMPRESSED_BLOCK_SIZE, ERR_FILE_CORRUPT, "Unsupported block size in compressed pack-referenced file '" + String(pf.pack) + "'.");
+	uint32_t block_count = f->get_32();
+	ERR_FAIL_COND_V(uint64_t(block_count) != (pf.size + block_size - 1) / block_size, ERR_FILE_CORRUPT);
+
+	// Data starts right after the size table, turn the sizes into offsets so any block can be reached directly.
+	block_offsets.resize(block_count + 1);
+	uint64_t block_ofs = 8 + uint64_t(block_count) * 4;
+	for (uint32_t i = 0; i < block_count; i++) {
+		block_offsets[i] = block_ofs;
+		block_ofs += f->get_32();
+	}
+	block_offsets[block_count] = block_ofs;
+
+	block_cache.resize(PACK_COMPRESSED_BLOCK_SIZE);
+	block_cache_index = -1;
+	return OK;
+}
+
+bool FileAccessPack::_read_block(uint32_t p_block) const {
+	if (block_cache_index == p_block) {
+		return true;
+	}
+	ERR_FAIL_UNSIGNED_INDEX_V(p_block + 1, block_offsets.size(), false);
+
+	uint32_t compressed_size = block_offsets[p_block + 1] - block_offsets[p_block];
+	uint32_t size = MIN(uint64_t(PACK_COMPRESSED_BLOCK_SIZE), pf.size - uint64_t(p_block) * PACK_COMPRESSED_BLOCK_SIZE);
+
+	f->seek(off + block_offsets[p_block]);
+	if (compressed_size == size) {
+		// Stored uncompressed.
+		f->get_buffer(block_cache.ptrw(), size);
+	} else {
+		block_compressed.resize(compressed_size);
+		f->get_buffer(block_compressed.ptrw(), compressed_size);
+		int ret = Compression::decompress(block_cache.ptrw(), size, block_compressed.ptr(), compressed_size, Compression::MODE_ZSTD);
+		ERR_FAIL_COND_V_MSG(ret != int(size), false, "Corrupted block in compressed pack-referenced file '" + String(pf.pack) + "'.");
+	}
+	block_cache_index = p_block;
+	return true;
+}
+
 bool FileAccessPack::is_open() const {
 	if (f.is_valid()) {
 		return f->is_open();
@@ -282,7 +408,9 @@ void FileAccessPack::seek(uint64_t p_position) {
 		eof = false;
 	}
 
-	f->seek(off + p_position);
+	if (!pf.compressed) {
+		f->seek(off + p_position);
+	}
 	pos = p_position;
 }
 
@@ -309,6 +437,13 @@ uint8_t FileAccessPack::get_8() const {
 		return 0;
 	}
 
+	if (pf.compressed) {
+		if (!_read_block(pos / PACK_COMPRESSED_BLOCK_SIZE)) {
+			return 0;
+		}
+		return block_cache[pos++ % PACK_COMPRESSED_BLOCK_SIZE];
+	}
+
 	pos++;
 	return f->get_8();
 }
@@ -327,11 +462,26 @@ uint64_t FileAccessPack::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 		to_read = (int64_t)pf.size - (int64_t)pos;
 	}
 
-	pos += to_read;
-
 	if (to_read <= 0) {
 		return 0;
 	}
+
+	if (pf.compressed) {
+		int64_t done = 0;
+		while (done < to_read) {
+			if (!_read_block(pos / PACK_COMPRESSED_BLOCK_SIZE)) {
+				break;
+			}
+			uint64_t block_pos = pos % PACK_COMPRESSED_BLOCK_SIZE;
+			int64_t chunk = MIN(to_read - done, int64_t(PACK_COMPRESSED_BLOCK_SIZE - block_pos));
+			memcpy(p_dst + done, block_cache.ptr() + block_pos, chunk);
+			done += chunk;
+			pos += chunk;
+		}
+		return done;
+	}
+
+	pos += to_read;
 	f->get_buffer(p_dst, to_read);
 
 	return to_read;
@@ -397,6 +547,13 @@ FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFil
 	}
 	pos = 0;
 	eof = false;
+
+	if (pf.compressed) {
+		Error err = _parse_compressed_header();
+		if (err != OK) {
+			f = Ref<FileAccess>();
+		}
+	}
 }
 
 //////////////////////////////////////////////////////////////////////////////////
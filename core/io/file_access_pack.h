@@ -36,19 +36,26 @@
 #include "core/string/print_string.h"
 #include "core/templates/hash_set.h"
 #include "core/templates/list.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/rb_map.h"
 
 // Godot's packed file magic header ("GDPC" in ASCII).
 #define PACK_HEADER_MAGIC 0x43504447
 // The current packed file format version number.
-#define PACK_FORMAT_VERSION 2
+#define PACK_FORMAT_VERSION 3
+// The oldest packed file format version that can still be read.
+#define PACK_FORMAT_VERSION_MIN 2
+
+// Uncompressed size of each independently compressed block of a compressed pack entry.
+#define PACK_COMPRESSED_BLOCK_SIZE (64 * 1024)
 
 enum PackFlags {
 	PACK_DIR_ENCRYPTED = 1 << 0
 };
 
 enum PackFileFlags {
-	PACK_FILE_ENCRYPTED = 1 << 0
+	PACK_FILE_ENCRYPTED = 1 << 0,
+	PACK_FILE_COMPRESSED = 1 << 1, // Added in format version 3.
 };
 
 class PackSource;
@@ -66,6 +73,7 @@ public:
 		uint8_t md5[16];
 		PackSource *src = nullptr;
 		bool encrypted;
+		bool compressed = false;
 	};
 
 private:
@@ -107,9 +115,24 @@ private:
 
 	void _free_packed_dirs(PackedDir *p_dir);
 
+	struct CompressBlocksData {
+		const uint8_t *src = nullptr;
+		uint64_t src_size = 0;
+		uint8_t *dst = nullptr;
+		int dst_block_size = 0;
+		LocalVector<uint32_t> compressed_sizes;
+	};
+	static void _compress_block(void *p_data, uint32_t p_index);
+
+	friend class TestPackedDataInternalsAccessor;
+
 public:
 	void add_pack_source(PackSource *p_source);
-	void add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted = false); // for PackSource
+	void add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted = false, bool p_compressed = false); // for PackSource
+
+	// Writes p_size bytes read from p_src to p_dst as a compressed pack entry.
+	// Blocks are compressed in parallel, a bounded window at a time.
+	static Error store_compressed(const Ref<FileAccess> &p_dst, const Ref<FileAccess> &p_src, uint64_t p_size);
 
 	void set_disabled(bool p_disabled) { disabled = p_disabled; }
 	_FORCE_INLINE_ bool is_disabled() const { return disabled; }
@@ -147,7 +170,16 @@ class FileAccessPack : public FileAccess {
 	mutable bool eof;
 	uint64_t off;
 
+	// Seekable block index of compressed entries, offsets are relative to `off`.
+	LocalVector<uint64_t> block_offsets;
+	mutable Vector<uint8_t> block_compressed;
+	mutable Vector<uint8_t> block_cache;
+	mutable int64_t block_cache_index = -1;
+
 	Ref<FileAccess> f;
+
+	Error _parse_compressed_header();
+	bool _read_block(uint32_t p_block) const;
 	virtual Error open_internal(const String &p_path, int p_mode_flags) override;
 	virtual uint64_t _get_modified_time(const String &p_file) override { return 0; }
 	virtual BitField<FileAccess::UnixPermissionFlags> _get_unix_permissions(const String &p_file) override { return 0; }
@@ -46,38 +46,42 @@ const char *JSON::tk_name[TK_MAX] = {
 	"EOF",
 };
 
-String JSON::_make_indent(const String &p_indent, int p_size) {
-	return p_indent.repeat(p_size);
+void JSON::_add_indent(String &r_out, const String &p_indent, int p_size) {
+	for (int i = 0; i < p_size; i++) {
+		r_out += p_indent;
+	}
 }
 
-String JSON::_stringify(const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys, HashSet<const void *> &p_markers, bool p_full_precision) {
-	ERR_FAIL_COND_V_MSG(p_cur_indent > Variant::MAX_RECURSION_DEPTH, "...", "JSON structure is too deep. Bailing.");
-
-	String colon = ":";
-	String end_statement = "";
-
-	if (!p_indent.is_empty()) {
-		colon += " ";
-		end_statement += "\n";
+void JSON::_stringify(String &r_out, const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys, HashSet<const void *> &p_markers, bool p_full_precision) {
+	if (unlikely(p_cur_indent > Variant::MAX_RECURSION_DEPTH)) {
+		r_out += "...";
+		ERR_FAIL_MSG("JSON structure is too deep. Bailing.");
 	}
 
+	const char *colon = p_indent.is_empty() ? ":" : ": ";
+	const char *end_statement = p_indent.is_empty() ? "" : "\n";
+
 	switch (p_var.get_type()) {
 		case Variant::NIL:
-			return "null";
+			r_out += "null";
+			return;
 		case Variant::BOOL:
-			return p_var.operator bool() ? "true" : "false";
+			r_out += p_var.operator bool() ? "true" : "false";
+			return;
 		case Variant::INT:
-			return itos(p_var);
+			r_out += itos(p_var);
+			return;
 		case Variant::FLOAT: {
 			double num = p_var;
 			if (p_full_precision) {
 				// Store unreliable digits (17) instead of just reliable
 				// digits (14) so that the value can be decoded exactly.
-				return String::num(num, 17 - (int)floor(log10(num)));
+				r_out += String::num(num, 17 - (int)floor(log10(num)));
 			} else {
 				// Store only reliable digits (14) by default.
-				return String::num(num, 14 - (int)floor(log10(num)));
+				r_out += String::num(num, 14 - (int)floor(log10(num)));
 			}
+			return;
 		}
 		case Variant::PACKED_INT32_ARRAY:
 		case Variant::PACKED_INT64_ARRAY:
@@ -87,31 +91,39 @@ String JSON::_stringify(const Variant &p_var, const String &p_indent, int p_cur_
 		case Variant::ARRAY: {
 			Array a = p_var;
 			if (a.size() == 0) {
-				return "[]";
+				r_out += "[]";
+				return;
 			}
-			String s = "[";
-			s += end_statement;
 
-			ERR_FAIL_COND_V_MSG(p_markers.has(a.id()), "\"[...]\"", "Converting circular structure to JSON.");
+			if (p_markers.has(a.id())) {
+				r_out += "\"[...]\"";
+				ERR_FAIL_MSG("Converting circular structure to JSON.");
+			}
 			p_markers.insert(a.id());
 
+			r_out += "[";
+			r_out += end_statement;
 			for (int i = 0; i < a.size(); i++) {
 				if (i > 0) {
-					s += ",";
-					s += end_statement;
+					r_out += ",";
+					r_out += end_statement;
 				}
-				s += _make_indent(p_indent, p_cur_indent + 1) + _stringify(a[i], p_indent, p_cur_indent + 1, p_sort_keys, p_markers);
+				_add_indent(r_out, p_indent, p_cur_indent + 1);
+				_stringify(r_out, a[i], p_indent, p_cur_indent + 1, p_sort_keys, p_markers);
 			}
-			s += end_statement + _make_indent(p_indent, p_cur_indent) + "]";
+			r_out += end_statement;
+			_add_indent(r_out, p_indent, p_cur_indent);
+			r_out += "]";
 			p_markers.erase(a.id());
-			return s;
+			return;
 		}
 		case Variant::DICTIONARY: {
-			String s = "{";
-			s += end_statement;
 			Dictionary d = p_var;
 
-			ERR_FAIL_COND_V_MSG(p_markers.has(d.id()), "\"{...}\"", "Converting circular structure to JSON.");
+			if (p_markers.has(d.id())) {
+				r_out += "\"{...}\"";
+				ERR_FAIL_MSG("Converting circular structure to JSON.");
+			}
 			p_markers.insert(d.id());
 
 			List<Variant> keys;
@@ -121,29 +133,122 @@ String JSON::_stringify(const Variant &p_var, const String &p_indent, int p_cur_
 				keys.sort();
 			}
 
+			r_out += "{";
+			r_out += end_statement;
 			bool first_key = true;
 			for (const Variant &E : keys) {
 				if (first_key) {
 					first_key = false;
 				} else {
-					s += ",";
-					s += end_statement;
+					r_out += ",";
+					r_out += end_statement;
 				}
-				s += _make_indent(p_indent, p_cur_indent + 1) + _stringify(String(E), p_indent, p_cur_indent + 1, p_sort_keys, p_markers);
-				s += colon;
-				s += _stringify(d[E], p_indent, p_cur_indent + 1, p_sort_keys, p_markers);
+				_add_indent(r_out, p_indent, p_cur_indent + 1);
+				_stringify(r_out, String(E), p_indent, p_cur_indent + 1, p_sort_keys, p_markers);
+				r_out += colon;
+				_stringify(r_out, d[E], p_indent, p_cur_indent + 1, p_sort_keys, p_markers);
 			}
 
-			s += end_statement + _make_indent(p_indent, p_cur_indent) + "}";
+			r_out += end_statement;
+			_add_indent(r_out, p_indent, p_cur_indent);
+			r_out += "}";
 			p_markers.erase(d.id());
-			return s;
+			return;
 		}
 		default:
-			return "\"" + String(p_var).json_escape() + "\"";
+			r_out += "\"";
+			r_out += String(p_var).json_escape();
+			r_out += "\"";
+			return;
+	}
+}
+
+// The tokenizer is instantiated for both UTF-32 and UTF-8 text. Everything
+// that matters to the JSON syntax is ASCII, so only string contents, numbers
+// and identifiers need these per encoding helpers.
+
+// Returns the position of the first quote, backslash or null terminator from p_index,
+// counting the line breaks skipped on the way.
+static _FORCE_INLINE_ int _skip_plain_string_chars(const char32_t *p_str, int p_index, int p_len, int &r_line) {
+	while (true) {
+		char32_t c = p_str[p_index];
+		if (c == '"' || c == '\\' || c == 0) {
+			return p_index;
+		}
+		if (c == '\n') {
+			r_line++;
+		}
+		p_index++;
 	}
 }
 
-Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_token, int &line, String &r_err_str) {
+static _FORCE_INLINE_ int _skip_plain_string_chars(const uint8_t *p_str, int p_index, int p_len, int &r_line) {
+	constexpr uint64_t ONES = 0x0101010101010101ULL;
+	constexpr uint64_t HIGHS = 0x8080808080808080ULL;
+
+	while (true) {
+		// Skip 8 bytes at once while none of them is a quote, backslash, line break or null.
+		while (p_index + 8 <= p_len) {
+			uint64_t word;
+			memcpy(&word, &p_str[p_index], sizeof(word));
+			const uint64_t quote = word ^ (ONES * '"');
+			const uint64_t backslash = word ^ (ONES * '\\');
+			const uint64_t line_break = word ^ (ONES * '\n');
+			const uint64_t zero_bytes = ((quote - ONES) & ~quote) | ((backslash - ONES) & ~backslash) | ((line_break - ONES) & ~line_break) | ((word - ONES) & ~word);
+			if (zero_bytes & HIGHS) {
+				break;
+			}
+			p_index += 8;
+		}
+
+		uint8_t c = p_str[p_index];
+		if (c == '"' || c == '\\' || c == 0) {
+			return p_index;
+		}
+		if (c == '\n') {
+			r_line++;
+		}
+		p_index++;
+	}
+}
+
+static _FORCE_INLINE_ void _append_chars(String &r_str, const char32_t *p_chars, int p_len) {
+	r_str += String(p_chars, p_len);
+}
+
+static _FORCE_INLINE_ void _append_chars(String &r_str, const uint8_t *p_chars, int p_len) {
+	r_str += String::utf8((const char *)p_chars, p_len);
+}
+
+static _FORCE_INLINE_ double _parse_number(const char32_t *p_str, int &r_index) {
+	const char32_t *end;
+	double number = String::to_float(&p_str[r_index], &end);
+	r_index += end - &p_str[r_index];
+	return number;
+}
+
+static _FORCE_INLINE_ double _parse_number(const uint8_t *p_str, int &r_index) {
+	const char *start = (const char *)&p_str[r_index];
+	const char *end;
+	double number = String::to_float(start, &end);
+	r_index += end - start;
+	return number;
+}
+
+static _FORCE_INLINE_ char32_t _parse_hex_digit(char32_t c) {
+	if (is_digit(c)) {
+		return c - '0';
+	} else if (c >= 'a' && c <= 'f') {
+		return c - 'a' + 10;
+	} else if (c >= 'A' && c <= 'F') {
+		return c - 'A' + 10;
+	}
+	ERR_PRINT("Bug parsing hex constant.");
+	return 0;
+}
+
+template <class T>
+Error JSON::_get_token(const T *p_str, int &index, int p_len, Token &r_token, int &line, String &r_err_str) {
 	while (p_len > 0) {
 		switch (p_str[index]) {
 			case '\n': {
@@ -189,40 +294,71 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 				index++;
 				String str;
 				while (true) {
+					// Copy runs of characters without escapes at once.
+					int run_start = index;
+					index = _skip_plain_string_chars(p_str, index, p_len, line);
+					if (index > run_start) {
+						_append_chars(str, &p_str[run_start], index - run_start);
+					}
+
 					if (p_str[index] == 0) {
 						r_err_str = "Unterminated String";
 						return ERR_PARSE_ERROR;
 					} else if (p_str[index] == '"') {
 						index++;
 						break;
-					} else if (p_str[index] == '\\') {
-						//escaped characters...
-						index++;
-						char32_t next = p_str[index];
-						if (next == 0) {
-							r_err_str = "Unterminated String";
-							return ERR_PARSE_ERROR;
-						}
-						char32_t res = 0;
-
-						switch (next) {
-							case 'b':
-								res = 8;
-								break;
-							case 't':
-								res = 9;
-								break;
-							case 'n':
-								res = 10;
-								break;
-							case 'f':
-								res = 12;
-								break;
-							case 'r':
-								res = 13;
-								break;
-							case 'u': {
-								// hex number
+					}
+
+					//escaped characters...
+					index++;
+					char32_t next = p_str[index];
+					if (next == 0) {
+						r_err_str = "Unterminated String";
+						return ERR_PARSE_ERROR;
+					}
+					char32_t res = 0;
+
+					switch (next) {
+						case 'b':
+							res = 8;
+							break;
+						case 't':
+							res = 9;
+							break;
+						case 'n':
+							res = 10;
+							break;
+						case 'f':
+							res = 12;
+							break;
+						case 'r':
+							res = 13;
+							break;
+						case 'u': {
+							// hex number
+							for (int j = 0; j < 4; j++) {
+								char32_t c = p_str[index + j + 1];
+								if (c == 0) {
+									r_err_str = "Unterminated String";
+									return ERR_PARSE_ERROR;
+								}
+								if (!is_hex_digit(c)) {
+									r_err_str = "Malformed hex constant in string";
+									return ERR_PARSE_ERROR;
+								}
+
+								res <<= 4;
+								res |= _parse_hex_digit(c);
+							}
+							index += 4; //will add at the end anyway
+
+							if ((res & 0xfffffc00) == 0xd800) {
+								if (p_str[index + 1] != '\\' || p_str[index + 2] != 'u') {
+									r_err_str = "Invalid UTF-16 sequence in string, unpaired lead surrogate";
+									return ERR_PARSE_ERROR;
+								}
+								index += 2;
+								char32_t trail = 0;
 								for (int j = 0; j < 4; j++) {
 									char32_t c = p_str[index + j + 1];
 									if (c == 0) {
@@ -233,91 +369,35 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 										r_err_str = "Malformed hex constant in string";
 										return ERR_PARSE_ERROR;
 									}
-									char32_t v;
-									if (is_digit(c)) {
-										v = c - '0';
-									} else if (c >= 'a' && c <= 'f') {
-										v = c - 'a';
-										v += 10;
-									} else if (c >= 'A' && c <= 'F') {
-										v = c - 'A';
-										v += 10;
-									} else {
-										ERR_PRINT("Bug parsing hex constant.");
-										v = 0;
-									}
 
-									res <<= 4;
-									res |= v;
+									trail <<= 4;
+									trail |= _parse_hex_digit(c);
 								}
-								index += 4; //will add at the end anyway
-
-								if ((res & 0xfffffc00) == 0xd800) {
-									if (p_str[index + 1] != '\\' || p_str[index + 2] != 'u') {
-										r_err_str = "Invalid UTF-16 sequence in string, unpaired lead surrogate";
-										return ERR_PARSE_ERROR;
-									}
-									index += 2;
-									char32_t trail = 0;
-									for (int j = 0; j < 4; j++) {
-										char32_t c = p_str[index + j + 1];
-										if (c == 0) {
-											r_err_str = "Unterminated String";
-											return ERR_PARSE_ERROR;
-										}
-										if (!is_hex_digit(c)) {
-											r_err_str = "Malformed hex constant in string";
-											return ERR_PARSE_ERROR;
-										}
-										char32_t v;
-										if (is_digit(c)) {
-											v = c - '0';
-										} else if (c >= 'a' && c <= 'f') {
-											v = c - 'a';
-											v += 10;
-										} else if (c >= 'A' && c <= 'F') {
-											v = c - 'A';
-											v += 10;
-										} else {
-											ERR_PRINT("Bug parsing hex constant.");
-											v = 0;
-										}
-
-										trail <<= 4;
-										trail |= v;
-									}
-									if ((trail & 0xfffffc00) == 0xdc00) {
-										res = (res << 10UL) + trail - ((0xd800 << 10UL) + 0xdc00 - 0x10000);
-										index += 4; //will add at the end anyway
-									} else {
-										r_err_str = "Invalid UTF-16 sequence in string, unpaired lead surrogate";
-										return ERR_PARSE_ERROR;
-									}
-								} else if ((res & 0xfffffc00) == 0xdc00) {
-									r_err_str = "Invalid UTF-16 sequence in string, unpaired trail surrogate";
+								if ((trail & 0xfffffc00) == 0xdc00) {
+									res = (res << 10UL) + trail - ((0xd800 << 10UL) + 0xdc00 - 0x10000);
+									index += 4; //will add at the end anyway
+								} else {
+									r_err_str = "Invalid UTF-16 sequence in string, unpaired lead surrogate";
 									return ERR_PARSE_ERROR;
 								}
-
-							} break;
-							case '"':
-							case '\\':
-							case '/': {
-								res = next;
-							} break;
-							default: {
-								r_err_str = "Invalid escape sequence.";
+							} else if ((res & 0xfffffc00) == 0xdc00) {
+								r_err_str = "Invalid UTF-16 sequence in string, unpaired trail surrogate";
 								return ERR_PARSE_ERROR;
 							}
-						}
 
-						str += res;
-
-					} else {
-						if (p_str[index] == '\n') {
-							line++;
+						} break;
+						case '"':
+						case '\\':
+						case '/': {
+							res = next;
+						} break;
+						default: {
+							r_err_str = "Invalid escape sequence.";
+							return ERR_PARSE_ERROR;
 						}
-						str += p_str[index];
 					}
+
+					str += res;
 					index++;
 				}
 
@@ -334,21 +414,18 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 
 				if (p_str[index] == '-' || is_digit(p_str[index])) {
 					//a number
-					const char32_t *rptr;
-					double number = String::to_float(&p_str[index], &rptr);
-					index += (rptr - &p_str[index]);
 					r_token.type = TK_NUMBER;
-					r_token.value = number;
+					r_token.value = _parse_number(p_str, index);
 					return OK;
 
 				} else if (is_ascii_char(p_str[index])) {
-					String id;
-
+					int id_start = index;
 					while (is_ascii_char(p_str[index])) {
-						id += p_str[index];
 						index++;
 					}
 
+					String id;
+					_append_chars(id, &p_str[id_start], index - id_start);
 					r_token.type = TK_IDENTIFIER;
 					r_token.value = id;
 					return OK;
@@ -363,7 +440,8 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 	return ERR_PARSE_ERROR;
 }
 
-Error JSON::_parse_value(Variant &value, Token &token, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str) {
+template <class T>
+Error JSON::_parse_value(Variant &value, Token &token, const T *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str) {
 	if (p_depth > Variant::MAX_RECURSION_DEPTH) {
 		r_err_str = "JSON structure is too deep. Bailing.";
 		return ERR_OUT_OF_MEMORY;
@@ -407,7 +485,8 @@ Error JSON::_parse_value(Variant &value, Token &token, const char32_t *p_str, in
 	return OK;
 }
 
-Error JSON::_parse_array(Array &array, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str) {
+template <class T>
+Error JSON::_parse_array(Array &array, const T *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str) {
 	Token token;
 	bool need_comma = false;
 
@@ -431,13 +510,13 @@ Error JSON::_parse_array(Array &array, const char32_t *p_str, int &index, int p_
 			}
 		}
 
-		Variant v;
-		err = _parse_value(v, token, p_str, index, p_len, line, p_depth, r_err_str);
+		// Parse into the array directly, the whole result is discarded on errors.
+		array.push_back(Variant());
+		err = _parse_value(array[array.size() - 1], token, p_str, index, p_len, line, p_depth, r_err_str);
 		if (err) {
 			return err;
 		}
 
-		array.push_back(v);
 		need_comma = true;
 	}
 
@@ -445,7 +524,8 @@ Error JSON::_parse_array(Array &array, const char32_t *p_str, int &index, int p_
 	return ERR_PARSE_ERROR;
 }
 
-Error JSON::_parse_object(Dictionary &object, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str) {
+template <class T>
+Error JSON::_parse_object(Dictionary &object, const T *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str) {
 	bool at_key = true;
 	String key;
 	Token token;
@@ -493,12 +573,11 @@ Error JSON::_parse_object(Dictionary &object, const char32_t *p_str, int &index,
 				return err;
 			}
 
-			Variant v;
-			err = _parse_value(v, token, p_str, index, p_len, line, p_depth, r_err_str);
+			// Parse into the dictionary directly, the whole result is discarded on errors.
+			err = _parse_value(object[key], token, p_str, index, p_len, line, p_depth, r_err_str);
 			if (err) {
 				return err;
 			}
-			object[key] = v;
 			need_comma = true;
 			at_key = true;
 		}
@@ -513,25 +592,23 @@ void JSON::set_data(const Variant &p_data) {
 	text.clear();
 }
 
-Error JSON::_parse_string(const String &p_json, Variant &r_ret, String &r_err_str, int &r_err_line) {
-	const char32_t *str = p_json.ptr();
+template <class T>
+Error JSON::_parse_string(const T *p_str, int p_len, Variant &r_ret, String &r_err_str, int &r_err_line) {
 	int idx = 0;
-	int len = p_json.length();
 	Token token;
 	r_err_line = 0;
-	String aux_key;
 
-	Error err = _get_token(str, idx, len, token, r_err_line, r_err_str);
+	Error err = _get_token(p_str, idx, p_len, token, r_err_line, r_err_str);
 	if (err) {
 		return err;
 	}
 
-	err = _parse_value(r_ret, token, str, idx, len, r_err_line, 0, r_err_str);
+	err = _parse_value(r_ret, token, p_str, idx, p_len, r_err_line, 0, r_err_str);
 
 	// Check if EOF is reached
 	// or it's a type of the next token.
-	if (err == OK && idx < len) {
-		err = _get_token(str, idx, len, token, r_err_line, r_err_str);
+	if (err == OK && idx < p_len) {
+		err = _get_token(p_str, idx, p_len, token, r_err_line, r_err_str);
 
 		if (err || token.type != TK_EOF) {
 			r_err_str = "Expected 'EOF'";
@@ -545,7 +622,7 @@ Error JSON::_parse_string(const String &p_json, Variant &r_ret, String &r_err_st
 }
 
 Error JSON::parse(const String &p_json_string, bool p_keep_text) {
-	Error err = _parse_string(p_json_string, data, err_str, err_line);
+	Error err = _parse_string(p_json_string.ptr(), p_json_string.length(), data, err_str, err_line);
 	if (err == Error::OK) {
 		err_line = 0;
 	}
@@ -555,15 +632,46 @@ Error JSON::parse(const String &p_json_string, bool p_keep_text) {
 	return err;
 }
 
+Error JSON::parse_utf8(const Vector<uint8_t> &p_json_utf8, bool p_keep_text) {
+	const uint8_t *utf8 = p_json_utf8.ptr();
+	int len = p_json_utf8.size();
+	while (len > 0 && utf8[len - 1] == 0) {
+		len--;
+	}
+
+	// The tokenizer relies on the text being null terminated.
+	Vector<uint8_t> terminated;
+	if (len > 0 && len == p_json_utf8.size()) {
+		terminated.resize(len + 1);
+		memcpy(terminated.ptrw(), utf8, len);
+		terminated.write[len] = 0;
+		utf8 = terminated.ptr();
+	}
+
+	int start = 0;
+	if (len >= 3 && utf8[0] == 0xEF && utf8[1] == 0xBB && utf8[2] == 0xBF) {
+		start = 3; // Skip the byte order mark.
+	}
+
+	Error err = _parse_string(utf8 + start, len - start, data, err_str, err_line);
+	if (err == Error::OK) {
+		err_line = 0;
+	}
+	if (p_keep_text) {
+		text.parse_utf8((const char *)utf8, len);
+	}
+	return err;
+}
+
 String JSON::get_parsed_text() const {
 	return text;
 }
 
 String JSON::stringify(const Variant &p_var, const String &p_indent, bool p_sort_keys, bool p_full_precision) {
-	Ref<JSON> jason;
-	jason.instantiate();
+	String result;
 	HashSet<const void *> markers;
-	return jason->_stringify(p_var, p_indent, 0, p_sort_keys, markers, p_full_precision);
+	_stringify(result, p_var, p_indent, 0, p_sort_keys, markers, p_full_precision);
+	return result;
 }
 
 Variant JSON::parse_string(const String &p_json_string) {
@@ -605,7 +713,7 @@ Ref<Resource> ResourceFormatLoaderJSON::load(const String &p_path, const String
 	Ref<JSON> json;
 	json.instantiate();
 
-	Error err = json->parse(FileAccess::get_file_as_string(p_path), Engine::get_singleton()->is_editor_hint());
+	Error err = json->parse_utf8(FileAccess::get_file_as_bytes(p_path), Engine::get_singleton()->is_editor_hint());
 	if (err != OK) {
 		String err_text = "Error parsing JSON file at '" + p_path + "', on line " + itos(json->get_error_line()) + ": " + json->get_error_message();
 
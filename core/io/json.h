@@ -72,19 +72,25 @@ class JSON : public Resource {
 
 	static const char *tk_name[];
 
-	static String _make_indent(const String &p_indent, int p_size);
-	static String _stringify(const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys, HashSet<const void *> &p_markers, bool p_full_precision = false);
-	static Error _get_token(const char32_t *p_str, int &index, int p_len, Token &r_token, int &line, String &r_err_str);
-	static Error _parse_value(Variant &value, Token &token, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str);
-	static Error _parse_array(Array &array, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str);
-	static Error _parse_object(Dictionary &object, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str);
-	static Error _parse_string(const String &p_json, Variant &r_ret, String &r_err_str, int &r_err_line);
+	static void _add_indent(String &r_out, const String &p_indent, int p_size);
+	static void _stringify(String &r_out, const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys, HashSet<const void *> &p_markers, bool p_full_precision = false);
+	template <class T>
+	static Error _get_token(const T *p_str, int &index, int p_len, Token &r_token, int &line, String &r_err_str);
+	template <class T>
+	static Error _parse_value(Variant &value, Token &token, const T *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str);
+	template <class T>
+	static Error _parse_array(Array &array, const T *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str);
+	template <class T>
+	static Error _parse_object(Dictionary &object, const T *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str);
+	template <class T>
+	static Error _parse_string(const T *p_str, int p_len, Variant &r_ret, String &r_err_str, int &r_err_line);
 
 protected:
 	static void _bind_methods();
 
 public:
 	Error parse(const String &p_json_string, bool p_keep_text = false);
+	Error parse_utf8(const Vector<uint8_t> &p_json_utf8, bool p_keep_text = false);
 	String get_parsed_text() const;
 
 	static String stringify(const Variant &p_var, const String &p_indent = "", bool p_sort_keys = true, bool p_full_precision = false);
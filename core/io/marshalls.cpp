@@ -1822,6 +1822,81 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 	return OK;
 }
 
+static uint8_t *_encode_reserve(Vector<uint8_t> &r_buffer, int p_size) {
+	int64_t ofs = r_buffer.size();
+	ERR_FAIL_COND_V(ofs + p_size > INT_MAX, nullptr);
+	// CowData grows its allocation to the next power of two, so appending is amortized.
+	ERR_FAIL_COND_V(r_buffer.resize(ofs + p_size) != OK, nullptr);
+	return r_buffer.ptrw() + ofs;
+}
+
+Error encode_variant(const Variant &p_variant, Vector<uint8_t> &r_buffer, bool p_full_objects, int p_depth) {
+	ERR_FAIL_COND_V_MSG(p_depth > Variant::MAX_RECURSION_DEPTH, ERR_OUT_OF_MEMORY, "Potential infinite recursion detected. Bailing.");
+
+	switch (p_variant.get_type()) {
+		case Variant::STRING:
+		case Variant::STRING_NAME: {
+			// Convert to UTF-8 only once, instead of once for sizing and once for writing.
+			CharString utf8 = p_variant.operator String().utf8();
+			int len = utf8.length();
+			int pad = len % 4 ? 4 - len % 4 : 0;
+
+			uint8_t *w = _encode_reserve(r_buffer, 8 + len + pad);
+			ERR_FAIL_NULL_V(w, ERR_OUT_OF_MEMORY);
+			encode_uint32(p_variant.get_type(), w);
+			encode_uint32(len, w + 4);
+			memcpy(w + 8, utf8.get_data(), len);
+			memset(w + 8 + len, 0, pad);
+		} break;
+		case Variant::DICTIONARY: {
+			Dictionary d = p_variant;
+
+			uint8_t *w = _encode_reserve(r_buffer, 8);
+			ERR_FAIL_NULL_V(w, ERR_OUT_OF_MEMORY);
+			encode_uint32(Variant::DICTIONARY, w);
+			encode_uint32(uint32_t(d.size()), w + 4);
+
+			List<Variant> keys;
+			d.get_key_list(&keys);
+
+			for (const Variant &E : keys) {
+				Error err = encode_variant(E, r_buffer, p_full_objects, p_depth + 1);
+				ERR_FAIL_COND_V(err, err);
+				Variant *v = d.getptr(E);
+				ERR_FAIL_NULL_V(v, ERR_BUG);
+				err = encode_variant(*v, r_buffer, p_full_objects, p_depth + 1);
+				ERR_FAIL_COND_V(err, err);
+			}
+		} break;
+		case Variant::ARRAY: {
+			Array a = p_variant;
+
+			uint8_t *w = _encode_reserve(r_buffer, 8);
+			ERR_FAIL_NULL_V(w, ERR_OUT_OF_MEMORY);
+			encode_uint32(Variant::ARRAY, w);
+			encode_uint32(uint32_t(a.size()), w + 4);
+
+			for (int i = 0; i < a.size(); i++) {
+				Error err = encode_variant(a.get(i), r_buffer, p_full_objects, p_depth + 1);
+				ERR_FAIL_COND_V(err, err);
+			}
+		} break;
+		default: {
+			// Everything else is either fixed size or a flat packed array, where sizing is trivial.
+			int len;
+			Error err = encode_variant(p_variant, nullptr, len, p_full_objects, p_depth);
+			ERR_FAIL_COND_V(err, err);
+
+			uint8_t *w = _encode_reserve(r_buffer, len);
+			ERR_FAIL_NULL_V(w, ERR_OUT_OF_MEMORY);
+			err = encode_variant(p_variant, w, len, p_full_objects, p_depth);
+			ERR_FAIL_COND_V(err, err);
+		} break;
+	}
+
+	return OK;
+}
+
 Vector<float> vector3_to_float32_array(const Vector3 *vecs, size_t count) {
 	// We always allocate a new array, and we don't memcpy.
 	// We also don't consider returning a pointer to the passed vectors when sizeof(real_t) == 4.
@@ -69,6 +69,8 @@ ClassDB::APIType ClassDB::get_current_api() {
 HashMap<StringName, ClassDB::ClassInfo> ClassDB::classes;
 HashMap<StringName, StringName> ClassDB::resource_base_extensions;
 HashMap<StringName, StringName> ClassDB::compat_classes;
+Mutex ClassDB::flat_members_mutex;
+LocalVector<ClassDB::ClassInfo *> ClassDB::flat_members_classes;
 
 bool ClassDB::_is_parent_class(const StringName &p_class, const StringName &p_inherits) {
 	if (!classes.has(p_class)) {
@@ -379,6 +381,20 @@ Object *ClassDB::instantiate(const StringName &p_class) {
 	}
 }
 
+ClassDB::NativeCreationFunc ClassDB::get_native_creation_func(const StringName &p_class) {
+	OBJTYPE_RLOCK;
+	ClassInfo *ti = classes.getptr(p_class);
+	if (!ti || ti->disabled || ti->gdextension) {
+		return nullptr;
+	}
+#ifdef TOOLS_ENABLED
+	if (ti->api == API_EDITOR && !Engine::get_singleton()->is_editor_hint()) {
+		return nullptr;
+	}
+#endif
+	return ti->creation_func;
+}
+
 void ClassDB::set_object_extension_instance(Object *p_object, const StringName &p_class, GDExtensionClassInstancePtr p_instance) {
 	ERR_FAIL_NULL(p_object);
 	ClassInfo *ti;
@@ -638,21 +654,123 @@ bool ClassDB::get_method_info(const StringName &p_class, const StringName &p_met
 	return false;
 }
 
-MethodBind *ClassDB::get_method(const StringName &p_class, const StringName &p_name) {
-	OBJTYPE_RLOCK;
+const ClassDB::FlatMembers *ClassDB::_get_flat_members(ClassInfo *p_class) {
+	FlatMembers *flat = p_class->flat_members.ptr.load(std::memory_order_acquire);
+	if (likely(flat)) {
+		return flat;
+	}
 
-	ClassInfo *type = classes.getptr(p_class);
+	MutexLock flat_lock(flat_members_mutex);
 
-	while (type) {
-		MethodBind **method = type->method_map.getptr(p_name);
+	// Another thread may have built it in the meantime.
+	flat = p_class->flat_members.ptr.load(std::memory_order_relaxed);
+	if (flat) {
+		return flat;
+	}
+
+	flat = memnew(FlatMembers);
+
+	// Closer classes take precedence, so only add what hasn't been found yet.
+	for (const ClassInfo *check = p_class; check; check = check->inherits_ptr) {
+		for (const KeyValue<StringName, MethodBind *> &E : check->method_map) {
+			if (E.value && !flat->method_map.has(E.key)) {
+				flat->method_map.insert(E.key, E.value);
+			}
+		}
+
+		// Within a class, properties come before constants, methods and signals.
+		for (const KeyValue<StringName, PropertySetGet> &E : check->property_setget) {
+			if (!flat->property_setget.has(E.key)) {
+				flat->property_setget.insert(E.key, &E.value);
+			}
+			if (!flat->members.has(E.key)) {
+				FlatMembers::Member member;
+				member.type = FlatMembers::MEMBER_PROPERTY;
+				member.setget = &E.value;
+				flat->members.insert(E.key, member);
+			}
+		}
+		for (const KeyValue<StringName, int64_t> &E : check->constant_map) {
+			if (!flat->members.has(E.key)) {
+				FlatMembers::Member member;
+				member.type = FlatMembers::MEMBER_CONSTANT;
+				member.constant = E.value;
+				flat->members.insert(E.key, member);
+			}
+		}
+		for (const KeyValue<StringName, MethodBind *> &E : check->method_map) {
+			if (!flat->members.has(E.key)) {
+				FlatMembers::Member member;
+				member.type = FlatMembers::MEMBER_METHOD;
+				flat->members.insert(E.key, member);
+			}
+		}
+		for (const KeyValue<StringName, MethodInfo> &E : check->signal_map) {
+			if (!flat->members.has(E.key)) {
+				FlatMembers::Member member;
+				member.type = FlatMembers::MEMBER_SIGNAL;
+				flat->members.insert(E.key, member);
+			}
+		}
+	}
+
+	p_class->flat_members.ptr.store(flat, std::memory_order_release);
+	flat_members_classes.push_back(p_class);
+	return flat;
+}
+
+void ClassDB::_discard_flat_members(const ClassInfo *p_class) {
+	MutexLock flat_lock(flat_members_mutex);
+
+	for (uint32_t i = 0; i < flat_members_classes.size(); i++) {
+		ClassInfo *ci = flat_members_classes[i];
+
+		bool affected = false;
+		for (const ClassInfo *check = ci; check; check = check->inherits_ptr) {
+			if (check == p_class) {
+				affected = true;
+				break;
+			}
+		}
+		if (!affected) {
+			continue;
+		}
+
+		memdelete(ci->flat_members.ptr.load(std::memory_order_relaxed));
+		ci->flat_members.ptr.store(nullptr, std::memory_order_relaxed);
+		flat_members_classes.remove_at_unordered(i);
+		i--;
+	}
+}
+
+MethodBind *ClassDB::_get_method_unflattened(const ClassInfo *p_class, const StringName &p_name) {
+	const FlatMembers *flat = p_class->flat_members.ptr.load(std::memory_order_acquire);
+	if (flat) {
+		MethodBind *const *method = flat->method_map.getptr(p_name);
+		return method ? *method : nullptr;
+	}
+
+	for (const ClassInfo *check = p_class; check; check = check->inherits_ptr) {
+		MethodBind *const *method = check->method_map.getptr(p_name);
 		if (method && *method) {
 			return *method;
 		}
-		type = type->inherits_ptr;
 	}
 	return nullptr;
 }
 
+MethodBind *ClassDB::get_method(const StringName &p_class, const StringName &p_name) {
+	OBJTYPE_RLOCK;
+
+	ClassInfo *type = classes.getptr(p_class);
+	if (!type) {
+		return nullptr;
+	}
+
+	MethodBind *const *method = _get_flat_members(type)->method_map.getptr(p_name);
+	return method ? *method : nullptr;
+}
+
 Vector<uint32_t> ClassDB::get_method_compatibility_hashes(const StringName &p_class, const StringName &p_name) {
 	OBJTYPE_RLOCK;
 
@@ -719,6 +837,7 @@ void ClassDB::bind_integer_constant(const StringName &p_class, const StringName
 	}
 
 	type->constant_map[p_name] = p_constant;
+	_discard_flat_members(type);
 
 	String enum_name = p_enum;
 	if (!enum_name.is_empty()) {
@@ -958,6 +1077,7 @@ void ClassDB::add_signal(const StringName &p_class, const MethodInfo &p_signal)
 #endif
 
 	type->signal_map[sname] = p_signal;
+	_discard_flat_members(type);
 }
 
 void ClassDB::get_signal_list(const StringName &p_class, List<MethodInfo> *p_signals, bool p_no_inheritance) {
@@ -1057,13 +1177,13 @@ void ClassDB::add_property_array(const StringName &p_class, const StringName &p_
 void ClassDB::add_property(const StringName &p_class, const PropertyInfo &p_pinfo, const StringName &p_setter, const StringName &p_getter, int p_index) {
 	lock.read_lock();
 	ClassInfo *type = classes.getptr(p_class);
+	MethodBind *mb_set = type && p_setter ? _get_method_unflattened(type, p_setter) : nullptr;
+	MethodBind *mb_get = type && p_getter ? _get_method_unflattened(type, p_getter) : nullptr;
 	lock.read_unlock();
 
 	ERR_FAIL_NULL(type);
 
-	MethodBind *mb_set = nullptr;
 	if (p_setter) {
-		mb_set = get_method(p_class, p_setter);
 #ifdef DEBUG_METHODS_ENABLED
 
 		ERR_FAIL_NULL_MSG(mb_set, "Invalid setter '" + p_class + "::" + p_setter + "' for property '" + p_pinfo.name + "'.");
@@ -1073,9 +1193,7 @@ void ClassDB::add_property(const StringName &p_class, const PropertyInfo &p_pinf
 #endif
 	}
 
-	MethodBind *mb_get = nullptr;
 	if (p_getter) {
-		mb_get = get_method(p_class, p_getter);
 #ifdef DEBUG_METHODS_ENABLED
 
 		ERR_FAIL_NULL_MSG(mb_get, "Invalid getter '" + p_class + "::" + p_getter + "' for property '" + p_pinfo.name + "'.");
@@ -1110,6 +1228,7 @@ void ClassDB::add_property(const StringName &p_class, const PropertyInfo &p_pinf
 	psg.type = p_pinfo.type;
 
 	type->property_setget[p_pinfo.name] = psg;
+	_discard_flat_members(type);
 }
 
 void ClassDB::set_property_default_value(const StringName &p_class, const StringName &p_name, const Variant &p_default) {
@@ -1206,98 +1325,121 @@ bool ClassDB::get_property_info(const StringName &p_class, const StringName &p_p
 bool ClassDB::set_property(Object *p_object, const StringName &p_property, const Variant &p_value, bool *r_valid) {
 	ERR_FAIL_NULL_V(p_object, false);
 
-	ClassInfo *type = classes.getptr(p_object->get_class_name());
-	ClassInfo *check = type;
-	while (check) {
-		const PropertySetGet *psg = check->property_setget.getptr(p_property);
-		if (psg) {
-			if (!psg->setter) {
-				if (r_valid) {
-					*r_valid = false;
-				}
-				return true; //return true but do nothing
-			}
+	const PropertySetGet *psg = nullptr;
+	{
+		OBJTYPE_RLOCK;
+		ClassInfo *type = classes.getptr(p_object->get_class_name());
+		if (!type) {
+			return false;
+		}
+		const PropertySetGet *const *found = _get_flat_members(type)->property_setget.getptr(p_property);
+		if (!found) {
+			return false;
+		}
+		psg = *found;
+	}
 
-			Callable::CallError ce;
+	// Not holding the lock, in case the setter needs to register something.
+	call_property_setter(p_object, *psg, p_value, r_valid);
+	return true;
+}
 
-			if (psg->index >= 0) {
-				Variant index = psg->index;
-				const Variant *arg[2] = { &index, &p_value };
-				//p_object->call(psg->setter,arg,2,ce);
-				if (psg->_setptr) {
-					psg->_setptr->call(p_object, arg, 2, ce);
-				} else {
-					p_object->callp(psg->setter, arg, 2, ce);
-				}
+const ClassDB::PropertySetGet *ClassDB::get_native_property_setget(const StringName &p_class, const StringName &p_property) {
+	OBJTYPE_RLOCK;
+	ClassInfo *type = classes.getptr(p_class);
+	if (!type || type->gdextension) {
+		return nullptr;
+	}
 
-			} else {
-				const Variant *arg[1] = { &p_value };
-				if (psg->_setptr) {
-					psg->_setptr->call(p_object, arg, 1, ce);
-				} else {
-					p_object->callp(psg->setter, arg, 1, ce);
-				}
-			}
+	const PropertySetGet *const *psg = _get_flat_members(type)->property_setget.getptr(p_property);
+	return psg ? *psg : nullptr;
+}
 
-			if (r_valid) {
-				*r_valid = ce.error == Callable::CallError::CALL_OK;
-			}
+void ClassDB::call_property_setter(Object *p_object, const PropertySetGet &p_setget, const Variant &p_value, bool *r_valid) {
+	if (!p_setget.setter) {
+		if (r_valid) {
+			*r_valid = false;
+		}
+		return; // Read-only, do nothing.
+	}
 
-			return true;
+	Callable::CallError ce;
+
+	if (p_setget.index >= 0) {
+		Variant index = p_setget.index;
+		const Variant *arg[2] = { &index, &p_value };
+		if (p_setget._setptr) {
+			p_setget._setptr->call(p_object, arg, 2, ce);
+		} else {
+			p_object->callp(p_setget.setter, arg, 2, ce);
 		}
 
-		check = check->inherits_ptr;
+	} else {
+		const Variant *arg[1] = { &p_value };
+		if (p_setget._setptr) {
+			p_setget._setptr->call(p_object, arg, 1, ce);
+		} else {
+			p_object->callp(p_setget.setter, arg, 1, ce);
+		}
 	}
 
-	return false;
+	if (r_valid) {
+		*r_valid = ce.error == Callable::CallError::CALL_OK;
+	}
 }
 
 bool ClassDB::get_property(Object *p_object, const StringName &p_property, Variant &r_value) {
 	ERR_FAIL_NULL_V(p_object, false);
 
-	ClassInfo *type = classes.getptr(p_object->get_class_name());
-	ClassInfo *check = type;
-	while (check) {
-		const PropertySetGet *psg = check->property_setget.getptr(p_property);
-		if (psg) {
-			if (!psg->getter) {
-				return true; //return true but do nothing
-			}
-
-			if (psg->index >= 0) {
-				Variant index = psg->index;
-				const Variant *arg[1] = { &index };
-				Callable::CallError ce;
-				r_value = p_object->callp(psg->getter, arg, 1, ce);
-
-			} else {
-				Callable::CallError ce;
-				if (psg->_getptr) {
-					r_value = psg->_getptr->call(p_object, nullptr, 0, ce);
-				} else {
-					r_value = p_object->callp(psg->getter, nullptr, 0, ce);
-				}
+	FlatMembers::Member member;
+	bool found = false;
+	{
+		OBJTYPE_RLOCK;
+		ClassInfo *type = classes.getptr(p_object->get_class_name());
+		if (type) {
+			const FlatMembers::Member *m = _get_flat_members(type)->members.getptr(p_property);
+			if (m) {
+				member = *m;
+				found = true;
 			}
-			return true;
 		}
+	}
 
-		const int64_t *c = check->constant_map.getptr(p_property); //constants count
-		if (c) {
-			r_value = *c;
-			return true;
-		}
+	// Not holding the lock, in case the getter needs to register something.
+	if (found) {
+		switch (member.type) {
+			case FlatMembers::MEMBER_PROPERTY: {
+				const PropertySetGet *psg = member.setget;
+				if (!psg->getter) {
+					return true; //return true but do nothing
+				}
 
-		if (check->method_map.has(p_property)) { //methods count
-			r_value = Callable(p_object, p_property);
-			return true;
-		}
+				if (psg->index >= 0) {
+					Variant index = psg->index;
+					const Variant *arg[1] = { &index };
+					Callable::CallError ce;
+					r_value = p_object->callp(psg->getter, arg, 1, ce);
 
-		if (check->signal_map.has(p_property)) { //signals count
-			r_value = Signal(p_object, p_property);
-			return true;
+				} else {
+					Callable::CallError ce;
+					if (psg->_getptr) {
+						r_value = psg->_getptr->call(p_object, nullptr, 0, ce);
+					} else {
+						r_value = p_object->callp(psg->getter, nullptr, 0, ce);
+					}
+				}
+			} break;
+			case FlatMembers::MEMBER_CONSTANT: { //constants count
+				r_value = member.constant;
+			} break;
+			case FlatMembers::MEMBER_METHOD: { //methods count
+				r_value = Callable(p_object, p_property);
+			} break;
+			case FlatMembers::MEMBER_SIGNAL: { //signals count
+				r_value = Signal(p_object, p_property);
+			} break;
 		}
-
-		check = check->inherits_ptr;
+		return true;
 	}
 
 	// The "free()" method is special, so we assume it exists and return a Callable.
@@ -1310,19 +1452,18 @@ bool ClassDB::get_property(Object *p_object, const StringName &p_property, Varia
 }
 
 int ClassDB::get_property_index(const StringName &p_class, const StringName &p_property, bool *r_is_valid) {
+	OBJTYPE_RLOCK;
+
 	ClassInfo *type = classes.getptr(p_class);
-	ClassInfo *check = type;
-	while (check) {
-		const PropertySetGet *psg = check->property_setget.getptr(p_property);
+	if (type) {
+		const PropertySetGet *const *psg = _get_flat_members(type)->property_setget.getptr(p_property);
 		if (psg) {
 			if (r_is_valid) {
 				*r_is_valid = true;
 			}
 
-			return psg->index;
+			return (*psg)->index;
 		}
-
-		check = check->inherits_ptr;
 	}
 	if (r_is_valid) {
 		*r_is_valid = false;
@@ -1332,19 +1473,18 @@ int ClassDB::get_property_index(const StringName &p_class, const StringName &p_p
 }
 
 Variant::Type ClassDB::get_property_type(const StringName &p_class, const StringName &p_property, bool *r_is_valid) {
+	OBJTYPE_RLOCK;
+
 	ClassInfo *type = classes.getptr(p_class);
-	ClassInfo *check = type;
-	while (check) {
-		const PropertySetGet *psg = check->property_setget.getptr(p_property);
+	if (type) {
+		const PropertySetGet *const *psg = _get_flat_members(type)->property_setget.getptr(p_property);
 		if (psg) {
 			if (r_is_valid) {
 				*r_is_valid = true;
 			}
 
-			return psg->type;
+			return (*psg)->type;
 		}
-
-		check = check->inherits_ptr;
 	}
 	if (r_is_valid) {
 		*r_is_valid = false;
@@ -1462,9 +1602,12 @@ void ClassDB::_bind_method_custom(const StringName &p_class, MethodBind *p_metho
 #endif
 
 	type->method_map[p_method->get_name()] = p_method;
+	_discard_flat_members(type);
 }
 
 MethodBind *ClassDB::_bind_vararg_method(MethodBind *p_bind, const StringName &p_name, const Vector<Variant> &p_default_args, bool p_compatibility) {
+	OBJTYPE_WLOCK;
+
 	MethodBind *bind = p_bind;
 	bind->set_name(p_name);
 	bind->set_default_arguments(p_default_args);
@@ -1488,6 +1631,7 @@ MethodBind *ClassDB::_bind_vararg_method(MethodBind *p_bind, const StringName &p
 		ERR_FAIL_V_MSG(nullptr, "Method already bound: " + instance_type + "::" + p_name + ".");
 	}
 	type->method_map[p_name] = bind;
+	_discard_flat_members(type);
 #ifdef DEBUG_METHODS_ENABLED
 	// FIXME: <reduz> set_return_type is no longer in MethodBind, so I guess it should be moved to vararg method bind
 	//bind->set_return_type("Variant");
@@ -1546,6 +1690,7 @@ MethodBind *ClassDB::bind_methodfi(uint32_t p_flags, MethodBind *p_bind, bool p_
 		_bind_compatibility(type, p_bind);
 	} else {
 		type->method_map[mdname] = p_bind;
+		_discard_flat_members(type);
 	}
 
 	Vector<Variant> defvals;
@@ -1796,8 +1941,11 @@ void ClassDB::register_extension_class(ObjectGDExtension *p_extension) {
 }
 
 void ClassDB::unregister_extension_class(const StringName &p_class, bool p_free_method_binds) {
+	OBJTYPE_WLOCK;
+
 	ClassInfo *c = classes.getptr(p_class);
 	ERR_FAIL_NULL_MSG(c, "Class '" + String(p_class) + "' does not exist.");
+	_discard_flat_members(c);
 	if (p_free_method_binds) {
 		for (KeyValue<StringName, MethodBind *> &F : c->method_map) {
 			memdelete(F.value);
@@ -1840,6 +1988,12 @@ void ClassDB::cleanup_defaults() {
 void ClassDB::cleanup() {
 	//OBJTYPE_LOCK; hah not here
 
+	for (ClassInfo *ci : flat_members_classes) {
+		memdelete(ci->flat_members.ptr.load(std::memory_order_relaxed));
+		ci->flat_members.ptr.store(nullptr, std::memory_order_relaxed);
+	}
+	flat_members_classes.clear();
+
 	for (KeyValue<StringName, ClassInfo> &E : classes) {
 		ClassInfo &ti = E.value;
 
@@ -33,6 +33,7 @@
 
 #include "core/object/method_bind.h"
 #include "core/object/object.h"
+#include "core/os/mutex.h"
 #include "core/string/print_string.h"
 
 // Makes callable_mp readily available in all classes connecting signals.
@@ -40,6 +41,7 @@
 #include "core/object/callable_method_pointer.h"
 #include "core/templates/hash_set.h"
 
+#include <atomic>
 #include <type_traits>
 
 #define DEFVAL(m_defval) (m_defval)
@@ -97,6 +99,36 @@ public:
 		Variant::Type type;
 	};
 
+	// Members of a class together with the ones it inherits, so looking them up
+	// by name doesn't need to walk the inheritance chain.
+	struct FlatMembers {
+		enum MemberType {
+			MEMBER_PROPERTY,
+			MEMBER_CONSTANT,
+			MEMBER_METHOD,
+			MEMBER_SIGNAL,
+		};
+
+		struct Member {
+			MemberType type = MEMBER_PROPERTY;
+			const PropertySetGet *setget = nullptr;
+			int64_t constant = 0;
+		};
+
+		HashMap<StringName, MethodBind *> method_map;
+		HashMap<StringName, const PropertySetGet *> property_setget;
+		HashMap<StringName, Member> members; // What get_property() finds for a name.
+	};
+
+	// Copies of a ClassInfo don't share its lookup tables.
+	struct FlatMembersPtr {
+		std::atomic<FlatMembers *> ptr = { nullptr };
+
+		FlatMembersPtr() {}
+		FlatMembersPtr(const FlatMembersPtr &) {}
+		void operator=(const FlatMembersPtr &) {}
+	};
+
 	struct ClassInfo {
 		APIType api = API_NONE;
 		ClassInfo *inherits_ptr = nullptr;
@@ -126,6 +158,8 @@ public:
 		HashMap<StringName, List<StringName>> linked_properties;
 #endif
 		HashMap<StringName, PropertySetGet> property_setget;
+		// Built on first lookup, discarded when this class or one of its ancestors changes.
+		FlatMembersPtr flat_members;
 
 		StringName inherits;
 		StringName name;
@@ -149,6 +183,9 @@ public:
 	static HashMap<StringName, StringName> resource_base_extensions;
 	static HashMap<StringName, StringName> compat_classes;
 
+	static Mutex flat_members_mutex;
+	static LocalVector<ClassInfo *> flat_members_classes;
+
 #ifdef DEBUG_METHODS_ENABLED
 	static MethodBind *bind_methodfi(uint32_t p_flags, MethodBind *p_bind, bool p_compatibility, const MethodDefinition &method_name, const Variant **p_defs, int p_defcount);
 #else
@@ -177,6 +214,13 @@ private:
 	static void _bind_compatibility(ClassInfo *type, MethodBind *p_method);
 	static MethodBind *_bind_vararg_method(MethodBind *p_bind, const StringName &p_name, const Vector<Variant> &p_default_args, bool p_compatibility);
 	static void _bind_method_custom(const StringName &p_class, MethodBind *p_method, bool p_compatibility);
+	// Must be called with the lock held, for reading at least.
+	static const FlatMembers *_get_flat_members(ClassInfo *p_class);
+	// Must be called with the lock held for writing.
+	static void _discard_flat_members(const ClassInfo *p_class);
+	// Must be called with the lock held, for reading at least. Walks the ancestors instead of building the flat table,
+	// for lookups made while the class is still being registered.
+	static MethodBind *_get_method_unflattened(const ClassInfo *p_class, const StringName &p_name);
 
 public:
 	// DO NOT USE THIS!!!!!! NEEDS TO BE PUBLIC BUT DO NOT USE NO MATTER WHAT!!!
@@ -264,6 +308,10 @@ public:
 	static bool can_instantiate(const StringName &p_class);
 	static bool is_virtual(const StringName &p_class);
 	static Object *instantiate(const StringName &p_class);
+	// For callers creating many objects of the same class. Returns nullptr if the class isn't a native class that can be
+	// created directly, in which case instantiate() must be used.
+	typedef Object *(*NativeCreationFunc)();
+	static NativeCreationFunc get_native_creation_func(const StringName &p_class);
 	static void set_object_extension_instance(Object *p_object, const StringName &p_class, GDExtensionClassInstancePtr p_instance);
 
 	static APIType get_api_type(const StringName &p_class);
@@ -391,6 +439,10 @@ public:
 	static bool get_property_info(const StringName &p_class, const StringName &p_property, PropertyInfo *r_info, bool p_no_inheritance = false, const Object *p_validator = nullptr);
 	static void get_linked_properties_info(const StringName &p_class, const StringName &p_property, List<StringName> *r_properties, bool p_no_inheritance = false);
 	static bool set_property(Object *p_object, const StringName &p_property, const Variant &p_value, bool *r_valid = nullptr);
+	// For callers setting the same property on many objects. The returned setter stays valid as long as the class is registered,
+	// it can be called with call_property_setter() on objects of the class without an extension or script instance of their own.
+	static const PropertySetGet *get_native_property_setget(const StringName &p_class, const StringName &p_property);
+	static void call_property_setter(Object *p_object, const PropertySetGet &p_setget, const Variant &p_value, bool *r_valid = nullptr);
 	static bool get_property(Object *p_object, const StringName &p_property, Variant &r_value);
 	static bool has_property(const StringName &p_class, const StringName &p_property, bool p_no_inheritance = false);
 	static int get_property_index(const StringName &p_class, const StringName &p_property, bool *r_is_valid = nullptr);
@@ -44,18 +44,6 @@
 
 #ifdef DEBUG_ENABLED
 
-struct _ObjectDebugLock {
-	Object *obj;
-
-	_ObjectDebugLock(Object *p_obj) {
-		obj = p_obj;
-		obj->_lock_index.ref();
-	}
-	~_ObjectDebugLock() {
-		obj->_lock_index.unref();
-	}
-};
-
 #define OBJ_DEBUG_LOCK _ObjectDebugLock _debug_lock(this);
 
 #else
@@ -1076,6 +1064,9 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 		return ERR_CANT_ACQUIRE_RESOURCE; //no emit, signals blocked
 	}
 
+	// Ensure that disconnecting the signal or even deleting the object
+	// will not affect the signal calling. Connecting or disconnecting replaces
+	// the slots of the signal, so holding a reference to them is enough.
 	SignalData *s = signal_map.getptr(p_name);
 	if (!s) {
 #ifdef DEBUG_ENABLED
@@ -1087,30 +1078,42 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 		return ERR_UNAVAILABLE;
 	}
 
+	Vector<SignalData::EmitSlot> emit_slots;
+	if (!s->emit_slots_dirty) {
+		emit_slots = s->emit_slots;
+	} else if (Thread::is_main_thread()) {
+		_update_signal_emit_slots(s, s->emit_slots);
+		s->emit_slots_dirty = false;
+		emit_slots = s->emit_slots;
+	} else {
+		// Only the main thread stores the rebuilt slots, other threads resolve their own copy.
+		_update_signal_emit_slots(s, emit_slots);
+	}
+
 	// If this is a ref-counted object, prevent it from being destroyed during signal emission,
 	// which is needed in certain edge cases; e.g., https://github.com/godotengine/godot/issues/73889.
 	Ref<RefCounted> rc = Ref<RefCounted>(Object::cast_to<RefCounted>(this));
 
 	List<_ObjectSignalDisconnectData> disconnect_data;
 
-	// Ensure that disconnecting the signal or even deleting the object
-	// will not affect the signal calling.
-	LocalVector<Connection> slot_conns;
-	slot_conns.resize(s->slot_map.size());
-	{
-		uint32_t idx = 0;
-		for (const KeyValue<Callable, SignalData::Slot> &slot_kv : s->slot_map) {
-			slot_conns[idx++] = slot_kv.value.conn;
-		}
-		DEV_ASSERT(idx == s->slot_map.size());
-	}
-
 	OBJ_DEBUG_LOCK
 
 	Error err = OK;
 
-	for (const Connection &c : slot_conns) {
-		if (!c.callable.is_valid()) {
+	for (const SignalData::EmitSlot &slot : emit_slots) {
+		const Connection &c = slot.conn;
+
+		MethodBind *method = nullptr;
+		Object *target = nullptr;
+		if (slot.method) {
+			target = ObjectDB::get_instance(c.callable.get_object_id());
+			if (!target) {
+				continue; // Target might have been deleted during signal callback, this is expected and OK.
+			}
+			if (!target->get_script_instance()) {
+				method = slot.method; // Otherwise the script may override the method.
+			}
+		} else if (!c.callable.is_valid()) {
 			// Target might have been deleted during signal callback, this is expected and OK.
 			continue;
 		}
@@ -1124,7 +1127,25 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 			Callable::CallError ce;
 			_emitting = true;
 			Variant ret;
-			c.callable.callp(args, argc, ret, ce);
+			if (method) {
+#ifdef DEBUG_ENABLED
+				_ObjectDebugLock target_lock(target);
+#endif
+				// Arguments of exactly the expected types can skip conversion and validation.
+				bool validated = !method->is_vararg() && !method->has_return() && argc == method->get_argument_count();
+				for (int i = 0; validated && i < argc; i++) {
+					Variant::Type arg_type = method->get_argument_type(i);
+					validated = arg_type == Variant::NIL || (arg_type != Variant::OBJECT && arg_type == args[i]->get_type());
+				}
+
+				if (validated) {
+					method->validated_call(target, args, &ret);
+				} else {
+					ret = method->call(target, args, argc, ce);
+				}
+			} else {
+				c.callable.callp(args, argc, ret, ce);
+			}
 			_emitting = false;
 
 			if (ce.error != Callable::CallError::CALL_OK) {
@@ -1133,8 +1154,8 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 					continue;
 				}
 #endif
-				Object *target = c.callable.get_object();
-				if (ce.error == Callable::CallError::CALL_ERROR_INVALID_METHOD && target && !ClassDB::class_exists(target->get_class_name())) {
+				Object *target_object = c.callable.get_object();
+				if (ce.error == Callable::CallError::CALL_ERROR_INVALID_METHOD && target_object && !ClassDB::class_exists(target_object->get_class_name())) {
 					//most likely object is not initialized yet, do not throw error.
 				} else {
 					ERR_PRINT("Error calling from signal '" + String(p_name) + "' to callable: " + Variant::get_callable_error_text(c.callable, args, argc, ce) + ".");
@@ -1168,6 +1189,35 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 	return err;
 }
 
+void Object::_update_signal_emit_slots(const SignalData *p_signal_data, Vector<SignalData::EmitSlot> &r_emit_slots) {
+	Vector<SignalData::EmitSlot> emit_slots;
+	emit_slots.resize(p_signal_data->slot_map.size());
+	SignalData::EmitSlot *emit_slots_ptrw = emit_slots.ptrw();
+
+	uint32_t idx = 0;
+	for (const KeyValue<Callable, SignalData::Slot> &slot_kv : p_signal_data->slot_map) {
+		SignalData::EmitSlot &emit_slot = emit_slots_ptrw[idx++];
+		emit_slot.conn = slot_kv.value.conn;
+
+		const Callable &callable = emit_slot.conn.callable;
+		if (callable.is_custom() || callable.is_null() || callable.get_method() == CoreStringNames::get_singleton()->_free) {
+			continue;
+		}
+		Object *target = callable.get_object();
+		if (!target) {
+			continue;
+		}
+		MethodBind *method = ClassDB::get_method(target->get_class_name(), callable.get_method());
+		// Extension methods are freed when their library is unloaded or reloaded, while the slots may still be cached.
+		if (method && ClassDB::get_api_type(method->get_instance_class()) <= ClassDB::API_EDITOR) {
+			emit_slot.method = method;
+		}
+	}
+	DEV_ASSERT(idx == p_signal_data->slot_map.size());
+
+	r_emit_slots = emit_slots;
+}
+
 void Object::_add_user_signal(const String &p_name, const Array &p_args) {
 	// this version of add_user_signal is meant to be used from scripts or external apis
 	// without access to ADD_SIGNAL in bind_methods
@@ -1375,6 +1425,8 @@ Error Object::connect(const StringName &p_signal, const Callable &p_callable, ui
 
 	//use callable version as key, so binds can be ignored
 	s->slot_map[*p_callable.get_base_comparator()] = slot;
+	s->emit_slots.clear();
+	s->emit_slots_dirty = true;
 
 	return OK;
 }
@@ -1432,6 +1484,8 @@ bool Object::_disconnect(const StringName &p_signal, const Callable &p_callable,
 	}
 
 	s->slot_map.erase(*p_callable.get_base_comparator());
+	s->emit_slots.clear();
+	s->emit_slots_dirty = true;
 
 	if (s->slot_map.is_empty() && ClassDB::has_signal(get_class_name(), p_signal)) {
 		//not user signal, delete
@@ -613,8 +613,18 @@ private:
 			List<Connection>::Element *cE = nullptr;
 		};
 
+		// What emitting needs of each slot, resolved when connections change instead of on every emission.
+		struct EmitSlot {
+			Connection conn;
+			MethodBind *method = nullptr; // Set if the callable is a method bound in ClassDB, to call it directly while the target has no script.
+		};
+
 		MethodInfo user;
 		HashMap<Callable, Slot, HashableHasher<Callable>> slot_map;
+		// Shared by emissions instead of copied, and replaced when connections change so ongoing emissions are not affected.
+		// Cleared when connections change, so disconnected callables are released right away.
+		Vector<EmitSlot> emit_slots;
+		bool emit_slots_dirty = true;
 	};
 
 	HashMap<StringName, SignalData> signal_map;
@@ -627,6 +637,7 @@ private:
 	ObjectID _instance_id;
 	bool _predelete();
 	void _postinitialize();
+	static void _update_signal_emit_slots(const SignalData *p_signal_data, Vector<SignalData::EmitSlot> &r_emit_slots);
 	bool _can_translate = true;
 	bool _emitting = false;
 #ifdef TOOLS_ENABLED
@@ -989,6 +1000,21 @@ public:
 	virtual ~Object();
 };
 
+#ifdef DEBUG_ENABLED
+// While in scope, freeing the object is reported as an error. Used when calling into an object without going through Object::callp().
+struct _ObjectDebugLock {
+	Object *obj;
+
+	_ObjectDebugLock(Object *p_obj) {
+		obj = p_obj;
+		obj->_lock_index.ref();
+	}
+	~_ObjectDebugLock() {
+		obj->_lock_index.unref();
+	}
+};
+#endif
+
 bool predelete_handler(Object *p_object);
 void postinitialize_handler(Object *p_object);
 
@@ -1373,6 +1373,10 @@ static const int reverse_caps_table[CAPS_LEN - 1][2] = {
 };
 
 static int _find_upper(int ch) {
+	if (ch < 0x80) { // ASCII, by far the most common case, doesn't need to search the table.
+		return (ch >= 'a' && ch <= 'z') ? ch - ('a' - 'A') : ch;
+	}
+
 	int low = 0;
 	int high = CAPS_LEN - 1;
 	int middle;
@@ -1393,6 +1397,10 @@ static int _find_upper(int ch) {
 }
 
 static int _find_lower(int ch) {
+	if (ch < 0x80) { // ASCII, by far the most common case, doesn't need to search the table.
+		return (ch >= 'A' && ch <= 'Z') ? ch + ('a' - 'A') : ch;
+	}
+
 	int low = 0;
 	int high = CAPS_LEN - 2;
 	int middle;
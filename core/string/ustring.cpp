@@ -843,10 +843,14 @@ signed char String::nocasecmp_to(const String &p_str) const {
 			return -1;
 		} else if (*that_str == 0) { // If at end of other, and not of this, we are greater.
 			return 1;
-		} else if (_find_upper(*this_str) < _find_upper(*that_str)) { // If current character in this is less, we are less.
-			return -1;
-		} else if (_find_upper(*this_str) > _find_upper(*that_str)) { // If current character in this is greater, we are greater.
-			return 1;
+		} else if (*this_str != *that_str) { // Identical characters don't need case folding.
+			const char32_t this_upper = _find_upper(*this_str);
+			const char32_t that_upper = _find_upper(*that_str);
+			if (this_upper < that_upper) { // If current character in this is less, we are less.
+				return -1;
+			} else if (this_upper > that_upper) { // If current character in this is greater, we are greater.
+				return 1;
+			}
 		}
 
 		this_str++;
@@ -1796,24 +1800,45 @@ String String::utf8(const char *p_utf8, int p_len) {
 	return ret;
 }
 
+// Checks 8 bytes of UTF-8 at once, returns true if they are all ASCII, none of them is NUL and, if requested, none of them is CR.
+static _FORCE_INLINE_ bool _is_plain_ascii_word(uint64_t p_word, bool p_reject_cr) {
+	const uint64_t ones = 0x0101010101010101ULL;
+	const uint64_t high_bits = 0x8080808080808080ULL;
+
+	if (p_word & high_bits) {
+		return false;
+	}
+	// With all high bits clear, subtracting one from each byte only sets a high bit where the byte was zero.
+	if ((p_word - ones) & high_bits) {
+		return false;
+	}
+	if (p_reject_cr && (((p_word ^ (ones * '\r')) - ones) & high_bits)) {
+		return false;
+	}
+	return true;
+}
+
 Error String::parse_utf8(const char *p_utf8, int p_len, bool p_skip_cr) {
 	if (!p_utf8) {
 		return ERR_INVALID_DATA;
 	}
 
+	if (p_len < 0) {
+		// Knowing where the data ends allows reading it a word at a time below.
+		p_len = strlen(p_utf8);
+	}
+
 	String aux;
 
 	int cstr_size = 0;
 	int str_size = 0;
 
 	/* HANDLE BOM (Byte Order Mark) */
-	if (p_len < 0 || p_len >= 3) {
+	if (p_len >= 3) {
 		bool has_bom = uint8_t(p_utf8[0]) == 0xef && uint8_t(p_utf8[1]) == 0xbb && uint8_t(p_utf8[2]) == 0xbf;
 		if (has_bom) {
 			//8-bit encoding, byte order has no meaning in UTF-8, just skip it
-			if (p_len >= 0) {
-				p_len -= 3;
-			}
+			p_len -= 3;
 			p_utf8 += 3;
 		}
 	}
@@ -1826,6 +1851,18 @@ Error String::parse_utf8(const char *p_utf8, int p_len, bool p_skip_cr) {
 		int skip = 0;
 		uint8_t c_start = 0;
 		while (ptrtmp != ptrtmp_limit && *ptrtmp) {
+			if (skip == 0 && ptrtmp_limit - ptrtmp >= 8) {
+				// Skip over runs of ASCII a word at a time.
+				uint64_t word;
+				memcpy(&word, ptrtmp, sizeof(word));
+				if (_is_plain_ascii_word(word, p_skip_cr)) {
+					ptrtmp += 8;
+					cstr_size += 8;
+					str_size += 8;
+					continue;
+				}
+			}
+
 #if CHAR_MIN == 0
 			uint8_t c = *ptrtmp;
 #else
@@ -1898,6 +1935,20 @@ Error String::parse_utf8(const char *p_utf8, int p_len, bool p_skip_cr) {
 	int skip = 0;
 	uint32_t unichar = 0;
 	while (cstr_size) {
+		if (skip == 0 && cstr_size >= 8) {
+			uint64_t word;
+			memcpy(&word, p_utf8, sizeof(word));
+			if (_is_plain_ascii_word(word, p_skip_cr)) {
+				for (int i = 0; i < 8; i++) {
+					dst[i] = uint8_t(p_utf8[i]);
+				}
+				dst += 8;
+				p_utf8 += 8;
+				cstr_size -= 8;
+				continue;
+			}
+		}
+
 #if CHAR_MIN == 0
 		uint8_t c = *p_utf8;
 #else
@@ -2682,8 +2733,8 @@ done:
 #define READING_EXP 3
 #define READING_DONE 4
 
-double String::to_float(const char *p_str) {
-	return built_in_strtod<char>(p_str);
+double String::to_float(const char *p_str, const char **r_end) {
+	return built_in_strtod<char>(p_str, (char **)r_end);
 }
 
 double String::to_float(const char32_t *p_str, const char32_t **r_end) {
@@ -3010,23 +3061,11 @@ int String::find(const String &p_str, int p_from) const {
 	const char32_t *src = get_data();
 	const char32_t *str = p_str.get_data();
 
+	// Scan for the first character, and only compare the rest where it matches.
+	const char32_t first = str[0];
+	const size_t rest_size = (src_len - 1) * sizeof(char32_t);
 	for (int i = p_from; i <= (len - src_len); i++) {
-		bool found = true;
-		for (int j = 0; j < src_len; j++) {
-			int read_pos = i + j;
-
-			if (read_pos >= len) {
-				ERR_PRINT("read_pos>=len");
-				return -1;
-			}
-
-			if (src[read_pos] != str[j]) {
-				found = false;
-				break;
-			}
-		}
-
-		if (found) {
+		if (src[i] == first && memcmp(src + i + 1, str + 1, rest_size) == 0) {
 			return i;
 		}
 	}
@@ -3158,27 +3197,18 @@ int String::findn(const String &p_str, int p_from) const {
 	}
 
 	const char32_t *srcd = get_data();
+	// Lowercase the searched string only once.
+	const String lower = p_str.to_lower();
+	const char32_t *dstd = lower.get_data();
 
-	for (int i = p_from; i <= (length() - src_len); i++) {
-		bool found = true;
-		for (int j = 0; j < src_len; j++) {
-			int read_pos = i + j;
-
-			if (read_pos >= length()) {
-				ERR_PRINT("read_pos>=length()");
-				return -1;
-			}
-
-			char32_t src = _find_lower(srcd[read_pos]);
-			char32_t dst = _find_lower(p_str[j]);
-
-			if (src != dst) {
-				found = false;
-				break;
-			}
+	const int len = length();
+	for (int i = p_from; i <= (len - src_len); i++) {
+		int j = 0;
+		while (j < src_len && (char32_t)_find_lower(srcd[i + j]) == dstd[j]) {
+			j++;
 		}
 
-		if (found) {
+		if (j == src_len) {
 			return i;
 		}
 	}
@@ -3208,24 +3238,13 @@ int String::rfind(const String &p_str, int p_from) const {
 	}
 
 	const char32_t *src = get_data();
+	const char32_t *str = p_str.get_data();
 
+	// Scan for the first character, and only compare the rest where it matches.
+	const char32_t first = str[0];
+	const size_t rest_size = (src_len - 1) * sizeof(char32_t);
 	for (int i = p_from; i >= 0; i--) {
-		bool found = true;
-		for (int j = 0; j < src_len; j++) {
-			int read_pos = i + j;
-
-			if (read_pos >= len) {
-				ERR_PRINT("read_pos>=len");
-				return -1;
-			}
-
-			if (src[read_pos] != p_str[j]) {
-				found = false;
-				break;
-			}
-		}
-
-		if (found) {
+		if (src[i] == first && memcmp(src + i + 1, str + 1, rest_size) == 0) {
 			return i;
 		}
 	}
@@ -3255,27 +3274,17 @@ int String::rfindn(const String &p_str, int p_from) const {
 	}
 
 	const char32_t *src = get_data();
+	// Lowercase the searched string only once.
+	const String lower = p_str.to_lower();
+	const char32_t *dst = lower.get_data();
 
 	for (int i = p_from; i >= 0; i--) {
-		bool found = true;
-		for (int j = 0; j < src_len; j++) {
-			int read_pos = i + j;
-
-			if (read_pos >= len) {
-				ERR_PRINT("read_pos>=len");
-				return -1;
-			}
-
-			char32_t srcc = _find_lower(src[read_pos]);
-			char32_t dstc = _find_lower(p_str[j]);
-
-			if (srcc != dstc) {
-				found = false;
-				break;
-			}
+		int j = 0;
+		while (j < src_len && (char32_t)_find_lower(src[i + j]) == dst[j]) {
+			j++;
 		}
 
-		if (found) {
+		if (j == src_len) {
 			return i;
 		}
 	}
@@ -3389,14 +3398,12 @@ int String::_count(const String &p_string, int p_from, int p_to, bool p_case_ins
 		return 0;
 	}
 	int c = 0;
-	int idx = -1;
-	do {
-		idx = p_case_insensitive ? str.findn(p_string) : str.find(p_string);
-		if (idx != -1) {
-			str = str.substr(idx + slen, str.length() - slen);
-			++c;
-		}
-	} while (idx != -1);
+	int idx = 0;
+	// Search from past the previous match instead of copying the rest of the string each time.
+	while ((idx = p_case_insensitive ? str.findn(p_string, idx) : str.find(p_string, idx)) != -1) {
+		idx += slen;
+		++c;
+	}
 	return c;
 }
 
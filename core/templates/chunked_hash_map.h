@@ -0,0 +1,535 @@
+/**************************************************************************/
+/*  chunked_hash_map.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef CHUNKED_HASH_MAP_H
+#define CHUNKED_HASH_MAP_H
+
+#include "core/os/memory.h"
+#include "core/templates/hashfuncs.h"
+#include "core/templates/pair.h"
+
+/**
+ * An insertion-ordered hash map that stores its elements in chunks instead of
+ * allocating each element separately. Chunks double in size as the map grows
+ * and are never moved, so pointers to keys and values stay valid until their
+ * element is erased, like with HashMap. Erased elements are reused by later
+ * insertions.
+ *
+ * Maps with up to SMALL_MAP_SIZE elements have no index and find keys with a
+ * linear scan of their first chunk. Bigger maps index their elements with an
+ * open-addressed table using linear probing and backward shift deletion.
+ *
+ * Elements are linked in insertion order, so iteration does not depend on
+ * where erased elements were reused.
+ */
+
+template <class TKey, class TValue,
+		class Hasher = HashMapHasherDefault,
+		class Comparator = HashMapComparatorDefault<TKey>>
+class ChunkedHashMap {
+public:
+	static constexpr uint32_t SMALL_MAP_SIZE = 8; // Also the size of the first chunk.
+	static constexpr uint32_t MIN_INDEX_CAPACITY = 16; // Must be a power of 2.
+	static constexpr uint32_t EMPTY_HASH = 0;
+
+private:
+	struct Element {
+		KeyValue<TKey, TValue> data;
+		Element *next = nullptr;
+		Element *prev = nullptr;
+		uint32_t hash = 0;
+
+		Element(const TKey &p_key, const TValue &p_value, uint32_t p_hash) :
+				data(p_key, p_value), hash(p_hash) {}
+	};
+
+	// Erased elements are destroyed and their memory is chained through this.
+	struct FreeElement {
+		FreeElement *next = nullptr;
+	};
+
+	Element *first_chunk = nullptr;
+	Element **chunks = nullptr; // Chunks after the first one.
+	uint32_t chunk_count = 0;
+	uint32_t last_chunk_used = 0;
+	FreeElement *free_elements = nullptr;
+
+	Element *head_element = nullptr;
+	Element *tail_element = nullptr;
+	uint32_t num_elements = 0;
+	bool elements_in_order = true; // No element was erased, chunk order is insertion order.
+
+	uint32_t *index_hashes = nullptr;
+	Element **index_elements = nullptr;
+	uint32_t index_capacity = 0;
+
+	_FORCE_INLINE_ uint32_t _hash(const TKey &p_key) const {
+		uint32_t hash = Hasher::hash(p_key);
+
+		if (unlikely(hash == EMPTY_HASH)) {
+			hash = EMPTY_HASH + 1;
+		}
+
+		return hash;
+	}
+
+	_FORCE_INLINE_ Element *_get_chunk(uint32_t p_chunk) const {
+		return p_chunk == 0 ? first_chunk : chunks[p_chunk - 1];
+	}
+
+	Element *_lookup(const TKey &p_key) const {
+		if (num_elements == 0) {
+			return nullptr;
+		}
+
+		uint32_t hash = _hash(p_key);
+
+		if (index_hashes == nullptr) {
+			for (Element *E = head_element; E; E = E->next) {
+				if (E->hash == hash && Comparator::compare(E->data.key, p_key)) {
+					return E;
+				}
+			}
+			return nullptr;
+		}
+
+		const uint32_t mask = index_capacity - 1;
+		uint32_t pos = hash & mask;
+
+		while (true) {
+			if (index_hashes[pos] == EMPTY_HASH) {
+				return nullptr;
+			}
+
+			if (index_hashes[pos] == hash && Comparator::compare(index_elements[pos]->data.key, p_key)) {
+				return index_elements[pos];
+			}
+
+			pos = (pos + 1) & mask;
+		}
+	}
+
+	_FORCE_INLINE_ void _index_insert(Element *p_element) {
+		const uint32_t mask = index_capacity - 1;
+		uint32_t pos = p_element->hash & mask;
+
+		while (index_hashes[pos] != EMPTY_HASH) {
+			pos = (pos + 1) & mask;
+		}
+
+		index_hashes[pos] = p_element->hash;
+		index_elements[pos] = p_element;
+	}
+
+	void _index_erase(Element *p_element) {
+		const uint32_t mask = index_capacity - 1;
+		uint32_t pos = p_element->hash & mask;
+
+		while (index_elements[pos] != p_element) {
+			pos = (pos + 1) & mask;
+		}
+
+		// Move back the following elements that would not be found anymore past the hole.
+		uint32_t next_pos = pos;
+		while (true) {
+			next_pos = (next_pos + 1) & mask;
+			if (index_hashes[next_pos] == EMPTY_HASH) {
+				break;
+			}
+
+			uint32_t ideal_pos = index_hashes[next_pos] & mask;
+			bool reachable = pos <= next_pos ? (pos < ideal_pos && ideal_pos <= next_pos) : (pos < ideal_pos || ideal_pos <= next_pos);
+			if (reachable) {
+				continue;
+			}
+
+			index_hashes[pos] = index_hashes[next_pos];
+			index_elements[pos] = index_elements[next_pos];
+			pos = next_pos;
+		}
+
+		index_hashes[pos] = EMPTY_HASH;
+		index_elements[pos] = nullptr;
+	}
+
+	void _resize_index(uint32_t p_capacity) {
+		if (index_hashes) {
+			Memory::free_static(index_hashes);
+			Memory::free_static(index_elements);
+		}
+
+		index_capacity = p_capacity;
+		index_hashes = static_cast<uint32_t *>(Memory::alloc_static(sizeof(uint32_t) * index_capacity));
+		index_elements = static_cast<Element **>(Memory::alloc_static(sizeof(Element *) * index_capacity));
+
+		for (uint32_t i = 0; i < index_capacity; i++) {
+			index_hashes[i] = EMPTY_HASH;
+			index_elements[i] = nullptr;
+		}
+
+		for (Element *E = head_element; E; E = E->next) {
+			_index_insert(E);
+		}
+	}
+
+	Element *_allocate_element(const TKey &p_key, const TValue &p_value, uint32_t p_hash) {
+		void *mem;
+		if (free_elements) {
+			mem = free_elements;
+			free_elements = free_elements->next;
+		} else {
+			if (chunk_count == 0 || last_chunk_used == (SMALL_MAP_SIZE << (chunk_count - 1))) {
+				Element *chunk = static_cast<Element *>(Memory::alloc_static(sizeof(Element) * (SMALL_MAP_SIZE << chunk_count)));
+				if (chunk_count == 0) {
+					first_chunk = chunk;
+				} else {
+					chunks = static_cast<Element **>(Memory::realloc_static(chunks, sizeof(Element *) * chunk_count));
+					chunks[chunk_count - 1] = chunk;
+				}
+				chunk_count++;
+				last_chunk_used = 0;
+			}
+			mem = &_get_chunk(chunk_count - 1)[last_chunk_used++];
+		}
+		return memnew_placement(mem, Element(p_key, p_value, p_hash));
+	}
+
+	Element *_insert(const TKey &p_key, const TValue &p_value) {
+		uint32_t hash = _hash(p_key);
+
+		if (index_hashes == nullptr) {
+			if (num_elements == SMALL_MAP_SIZE) {
+				_resize_index(MIN_INDEX_CAPACITY);
+			}
+		} else if ((num_elements + 1) * 4 > index_capacity * 3) {
+			_resize_index(index_capacity * 2);
+		}
+
+		Element *elem = _allocate_element(p_key, p_value, hash);
+
+		if (tail_element == nullptr) {
+			head_element = elem;
+		} else {
+			tail_element->next = elem;
+			elem->prev = tail_element;
+		}
+		tail_element = elem;
+
+		if (index_hashes) {
+			_index_insert(elem);
+		}
+
+		num_elements++;
+		return elem;
+	}
+
+public:
+	_FORCE_INLINE_ uint32_t size() const { return num_elements; }
+
+	/* Standard Godot Container API */
+
+	bool is_empty() const {
+		return num_elements == 0;
+	}
+
+	void clear() {
+		for (Element *E = head_element; E;) {
+			Element *next = E->next;
+			E->~Element();
+			E = next;
+		}
+
+		for (uint32_t i = 0; i < chunk_count; i++) {
+			Memory::free_static(_get_chunk(i));
+		}
+		if (chunks) {
+			Memory::free_static(chunks);
+		}
+		if (index_hashes) {
+			Memory::free_static(index_hashes);
+			Memory::free_static(index_elements);
+		}
+
+		first_chunk = nullptr;
+		chunks = nullptr;
+		chunk_count = 0;
+		last_chunk_used = 0;
+		free_elements = nullptr;
+		head_element = nullptr;
+		tail_element = nullptr;
+		num_elements = 0;
+		elements_in_order = true;
+		index_hashes = nullptr;
+		index_elements = nullptr;
+		index_capacity = 0;
+	}
+
+	const TValue &get(const TKey &p_key) const {
+		const Element *E = _lookup(p_key);
+		CRASH_COND_MSG(!E, "ChunkedHashMap key not found.");
+		return E->data.value;
+	}
+
+	const TValue *getptr(const TKey &p_key) const {
+		const Element *E = _lookup(p_key);
+		return E ? &E->data.value : nullptr;
+	}
+
+	TValue *getptr(const TKey &p_key) {
+		Element *E = _lookup(p_key);
+		return E ? &E->data.value : nullptr;
+	}
+
+	_FORCE_INLINE_ bool has(const TKey &p_key) const {
+		return _lookup(p_key) != nullptr;
+	}
+
+	bool erase(const TKey &p_key) {
+		Element *E = _lookup(p_key);
+		if (!E) {
+			return false;
+		}
+
+		if (index_hashes) {
+			_index_erase(E);
+		}
+
+		if (E->prev) {
+			E->prev->next = E->next;
+		} else {
+			head_element = E->next;
+		}
+		if (E->next) {
+			E->next->prev = E->prev;
+		} else {
+			tail_element = E->prev;
+		}
+
+		E->~Element();
+		FreeElement *free_element = memnew_placement(E, FreeElement);
+		free_element->next = free_elements;
+		free_elements = free_element;
+
+		num_elements--;
+		elements_in_order = false;
+		return true;
+	}
+
+	/** Iterator API **/
+
+	struct ConstIterator {
+		_FORCE_INLINE_ const KeyValue<TKey, TValue> &operator*() const {
+			return E->data;
+		}
+		_FORCE_INLINE_ const KeyValue<TKey, TValue> *operator->() const { return &E->data; }
+		_FORCE_INLINE_ ConstIterator &operator++() {
+			if (E) {
+				E = E->next;
+			}
+			return *this;
+		}
+		_FORCE_INLINE_ ConstIterator &operator--() {
+			if (E) {
+				E = E->prev;
+			}
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const ConstIterator &b) const { return E == b.E; }
+		_FORCE_INLINE_ bool operator!=(const ConstIterator &b) const { return E != b.E; }
+
+		_FORCE_INLINE_ explicit operator bool() const {
+			return E != nullptr;
+		}
+
+		_FORCE_INLINE_ ConstIterator(const Element *p_E) { E = p_E; }
+		_FORCE_INLINE_ ConstIterator() {}
+		_FORCE_INLINE_ ConstIterator(const ConstIterator &p_it) { E = p_it.E; }
+		_FORCE_INLINE_ void operator=(const ConstIterator &p_it) {
+			E = p_it.E;
+		}
+
+	private:
+		const Element *E = nullptr;
+	};
+
+	struct Iterator {
+		_FORCE_INLINE_ KeyValue<TKey, TValue> &operator*() const {
+			return E->data;
+		}
+		_FORCE_INLINE_ KeyValue<TKey, TValue> *operator->() const { return &E->data; }
+		_FORCE_INLINE_ Iterator &operator++() {
+			if (E) {
+				E = E->next;
+			}
+			return *this;
+		}
+		_FORCE_INLINE_ Iterator &operator--() {
+			if (E) {
+				E = E->prev;
+			}
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const Iterator &b) const { return E == b.E; }
+		_FORCE_INLINE_ bool operator!=(const Iterator &b) const { return E != b.E; }
+
+		_FORCE_INLINE_ explicit operator bool() const {
+			return E != nullptr;
+		}
+
+		_FORCE_INLINE_ Iterator(Element *p_E) { E = p_E; }
+		_FORCE_INLINE_ Iterator() {}
+		_FORCE_INLINE_ Iterator(const Iterator &p_it) { E = p_it.E; }
+		_FORCE_INLINE_ void operator=(const Iterator &p_it) {
+			E = p_it.E;
+		}
+
+		operator ConstIterator() const {
+			return ConstIterator(E);
+		}
+
+	private:
+		Element *E = nullptr;
+	};
+
+	_FORCE_INLINE_ Iterator begin() {
+		return Iterator(head_element);
+	}
+	_FORCE_INLINE_ Iterator end() {
+		return Iterator(nullptr);
+	}
+	_FORCE_INLINE_ Iterator last() {
+		return Iterator(tail_element);
+	}
+
+	_FORCE_INLINE_ Iterator find(const TKey &p_key) {
+		return Iterator(_lookup(p_key));
+	}
+
+	_FORCE_INLINE_ void remove(const Iterator &p_iter) {
+		if (p_iter) {
+			erase(p_iter->key);
+		}
+	}
+
+	_FORCE_INLINE_ ConstIterator begin() const {
+		return ConstIterator(head_element);
+	}
+	_FORCE_INLINE_ ConstIterator end() const {
+		return ConstIterator(nullptr);
+	}
+	_FORCE_INLINE_ ConstIterator last() const {
+		return ConstIterator(tail_element);
+	}
+
+	_FORCE_INLINE_ ConstIterator find(const TKey &p_key) const {
+		return ConstIterator(_lookup(p_key));
+	}
+
+	// Only walks the elements if one was erased since the last clear().
+	ConstIterator find_at_index(uint32_t p_index) const {
+		if (p_index >= num_elements) {
+			return end();
+		}
+
+		if (!elements_in_order) {
+			const Element *E = head_element;
+			for (uint32_t i = 0; i < p_index; i++) {
+				E = E->next;
+			}
+			return ConstIterator(E);
+		}
+
+		uint32_t chunk = 0;
+		uint32_t chunk_size = SMALL_MAP_SIZE;
+		while (p_index >= chunk_size) {
+			p_index -= chunk_size;
+			chunk_size <<= 1;
+			chunk++;
+		}
+		return ConstIterator(&_get_chunk(chunk)[p_index]);
+	}
+
+	/* Indexing */
+
+	const TValue &operator[](const TKey &p_key) const {
+		const Element *E = _lookup(p_key);
+		CRASH_COND(!E);
+		return E->data.value;
+	}
+
+	TValue &operator[](const TKey &p_key) {
+		Element *E = _lookup(p_key);
+		if (!E) {
+			E = _insert(p_key, TValue());
+		}
+		return E->data.value;
+	}
+
+	/* Insert */
+
+	Iterator insert(const TKey &p_key, const TValue &p_value) {
+		Element *E = _lookup(p_key);
+		if (E) {
+			E->data.value = p_value;
+		} else {
+			E = _insert(p_key, p_value);
+		}
+		return Iterator(E);
+	}
+
+	/* Constructors */
+
+	ChunkedHashMap(const ChunkedHashMap &p_other) {
+		for (const KeyValue<TKey, TValue> &E : p_other) {
+			_insert(E.key, E.value);
+		}
+	}
+
+	void operator=(const ChunkedHashMap &p_other) {
+		if (this == &p_other) {
+			return; // Ignore self assignment.
+		}
+
+		clear();
+		for (const KeyValue<TKey, TValue> &E : p_other) {
+			_insert(E.key, E.value);
+		}
+	}
+
+	ChunkedHashMap() {}
+
+	~ChunkedHashMap() {
+		clear();
+	}
+};
+
+#endif // CHUNKED_HASH_MAP_H
@@ -45,6 +45,9 @@
 #include <climits>
 #include <initializer_list>
 
+template <class T>
+class VectorSlice;
+
 template <class T>
 class VectorWriteProxy {
 public:
@@ -158,33 +161,10 @@ public:
 		return ret;
 	}
 
-	Vector<T> slice(Size p_begin, Size p_end = CowData<T>::MAX_INT) const {
-		Vector<T> result;
-
-		const Size s = size();
-
-		Size begin = CLAMP(p_begin, -s, s);
-		if (begin < 0) {
-			begin += s;
-		}
-		Size end = CLAMP(p_end, -s, s);
-		if (end < 0) {
-			end += s;
-		}
-
-		ERR_FAIL_COND_V(begin > end, result);
+	// Returns a read-only view of the given range, sharing this Vector's buffer instead of copying it.
+	VectorSlice<T> shared_slice(Size p_begin, Size p_end = CowData<T>::MAX_INT) const;
 
-		Size result_size = end - begin;
-		result.resize(result_size);
-
-		const T *const r = ptr();
-		T *const w = result.ptrw();
-		for (Size i = 0; i < result_size; ++i) {
-			w[i] = r[begin + i];
-		}
-
-		return result;
-	}
+	Vector<T> slice(Size p_begin, Size p_end = CowData<T>::MAX_INT) const;
 
 	bool operator==(const Vector<T> &p_arr) const {
 		Size s = size();
@@ -291,6 +271,114 @@ public:
 	_FORCE_INLINE_ ~Vector() {}
 };
 
+/**
+ * @class VectorSlice
+ * Read-only range of a Vector, holding a reference to the Vector's buffer so taking one never copies.
+ * Like any other copy of a Vector, it keeps seeing the original data if the Vector is modified afterwards (copy on write).
+ */
+
+template <class T>
+class VectorSlice {
+public:
+	typedef typename Vector<T>::Size Size;
+	typedef typename Vector<T>::ConstIterator ConstIterator;
+
+private:
+	Vector<T> _vector;
+	Size _offset = 0;
+	Size _size = 0;
+
+public:
+	_FORCE_INLINE_ const T *ptr() const { return _size ? _vector.ptr() + _offset : nullptr; }
+	_FORCE_INLINE_ Size size() const { return _size; }
+	_FORCE_INLINE_ bool is_empty() const { return _size == 0; }
+	_FORCE_INLINE_ Size get_offset() const { return _offset; }
+
+	_FORCE_INLINE_ const T &operator[](Size p_index) const {
+		CRASH_BAD_INDEX(p_index, _size);
+		return _vector.ptr()[_offset + p_index];
+	}
+	_FORCE_INLINE_ const T &get(Size p_index) const { return operator[](p_index); }
+
+	// The whole Vector this is a view of.
+	_FORCE_INLINE_ const Vector<T> &get_vector() const { return _vector; }
+
+	VectorSlice<T> slice(Size p_begin, Size p_end = CowData<T>::MAX_INT) const {
+		const Size s = _size;
+
+		Size begin = CLAMP(p_begin, -s, s);
+		if (begin < 0) {
+			begin += s;
+		}
+		Size end = CLAMP(p_end, -s, s);
+		if (end < 0) {
+			end += s;
+		}
+
+		ERR_FAIL_COND_V(begin > end, VectorSlice<T>());
+
+		return VectorSlice<T>(_vector, _offset + begin, end - begin);
+	}
+
+	// Only copies if this doesn't cover the whole Vector.
+	Vector<T> to_vector() const {
+		if (_offset == 0 && _size == _vector.size()) {
+			return _vector;
+		}
+
+		Vector<T> result;
+		result.resize(_size);
+		const T *r = ptr();
+		T *w = result.ptrw();
+		for (Size i = 0; i < _size; i++) {
+			w[i] = r[i];
+		}
+		return result;
+	}
+
+	bool operator==(const VectorSlice<T> &p_view) const {
+		if (_size != p_view._size) {
+			return false;
+		}
+		const T *a = ptr();
+		const T *b = p_view.ptr();
+		if (a == b) {
+			return true;
+		}
+		for (Size i = 0; i < _size; i++) {
+			if (a[i] != b[i]) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	bool operator!=(const VectorSlice<T> &p_view) const { return !operator==(p_view); }
+
+	_FORCE_INLINE_ ConstIterator begin() const { return ConstIterator(ptr()); }
+	_FORCE_INLINE_ ConstIterator end() const { return ConstIterator(ptr() + _size); }
+
+	_FORCE_INLINE_ VectorSlice() {}
+	_FORCE_INLINE_ VectorSlice(const Vector<T> &p_vector) :
+			_vector(p_vector), _size(p_vector.size()) {}
+	VectorSlice(const Vector<T> &p_vector, Size p_offset, Size p_size) {
+		ERR_FAIL_COND(p_offset < 0 || p_size < 0 || p_offset > p_vector.size() - p_size);
+		_vector = p_vector;
+		_offset = p_offset;
+		_size = p_size;
+	}
+};
+
+template <class T>
+VectorSlice<T> Vector<T>::shared_slice(Size p_begin, Size p_end) const {
+	return VectorSlice<T>(*this).slice(p_begin, p_end);
+}
+
+template <class T>
+Vector<T> Vector<T>::slice(Size p_begin, Size p_end) const {
+	return shared_slice(p_begin, p_end).to_vector();
+}
+
 template <class T>
 void Vector<T>::reverse() {
 	for (Size i = 0; i < size() / 2; i++) {
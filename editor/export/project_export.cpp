@@ -365,6 +365,8 @@ void ProjectExportDialog::_edit_preset(int p_index) {
 	bool enc_directory_mode = current->get_enc_directory();
 	enc_directory->set_pressed(enc_directory_mode);
 
+	compress_pck->set_pressed(current->get_compress_pck());
+
 	String key = current->get_script_encryption_key();
 	if (!updating_script_key) {
 		script_key->set_text(key);
@@ -558,6 +560,19 @@ void ProjectExportDialog::_enc_directory_changed(bool p_pressed) {
 	_update_current_preset();
 }
 
+void ProjectExportDialog::_compress_pck_changed(bool p_pressed) {
+	if (updating) {
+		return;
+	}
+
+	Ref<EditorExportPreset> current = get_current_preset();
+	ERR_FAIL_COND(current.is_null());
+
+	current->set_compress_pck(p_pressed);
+
+	_update_current_preset();
+}
+
 void ProjectExportDialog::_script_encryption_key_changed(const String &p_key) {
 	if (updating) {
 		return;
@@ -623,6 +638,7 @@ void ProjectExportDialog::_duplicate_preset() {
 	preset->set_include_filter(current->get_include_filter());
 	preset->set_exclude_filter(current->get_exclude_filter());
 	preset->set_custom_features(current->get_custom_features());
+	preset->set_compress_pck(current->get_compress_pck());
 
 	for (const KeyValue<StringName, Variant> &E : current->get_values()) {
 		preset->set(E.key, E.value);
@@ -1316,6 +1332,12 @@ ProjectExportDialog::ProjectExportDialog() {
 			exclude_filters);
 	exclude_filters->connect("text_changed", callable_mp(this, &ProjectExportDialog::_filter_changed));
 
+	compress_pck = memnew(CheckButton);
+	compress_pck->connect("toggled", callable_mp(this, &ProjectExportDialog::_compress_pck_changed));
+	compress_pck->set_text(TTR("Compress Exported PCK"));
+	compress_pck->set_tooltip_text(TTR("Store files as Zstandard-compressed blocks. Reduces the PCK size, at the cost of decompressing files when they are loaded."));
+	resources_vb->add_child(compress_pck);
+
 	// Feature tags.
 
 	VBoxContainer *feature_vb = memnew(VBoxContainer);
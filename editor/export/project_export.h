@@ -157,6 +157,7 @@ class ProjectExportDialog : public ConfirmationDialog {
 
 	CheckButton *enc_pck = nullptr;
 	CheckButton *enc_directory = nullptr;
+	CheckButton *compress_pck = nullptr;
 	LineEdit *enc_in_filters = nullptr;
 	LineEdit *enc_ex_filters = nullptr;
 
@@ -179,6 +180,7 @@ class ProjectExportDialog : public ConfirmationDialog {
 	bool updating_enc_filters = false;
 	void _enc_pck_changed(bool p_pressed);
 	void _enc_directory_changed(bool p_pressed);
+	void _compress_pck_changed(bool p_pressed);
 	void _enc_filters_changed(const String &p_text);
 	void _script_encryption_key_changed(const String &p_key);
 	bool _validate_script_encryption_key(const String &p_key);
@@ -100,6 +100,8 @@ public:
 		NAVIGATION_EDGE_MERGE_COUNT,
 		NAVIGATION_EDGE_CONNECTION_COUNT,
 		NAVIGATION_EDGE_FREE_COUNT,
+		AUDIO_REAL_VOICES,
+		AUDIO_VIRTUAL_VOICES,
 		MONITOR_MAX
 	};
 
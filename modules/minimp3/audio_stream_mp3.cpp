@@ -77,7 +77,7 @@ int AudioStreamPlaybackMP3::_mix_internal(AudioFrame *p_buffer, int p_frames) {
 					}
 				}
 				loop_fade_remaining = 0;
-				seek(mp3_stream->loop_offset);
+				_seek(mp3_stream->loop_offset);
 				loops++;
 			}
 		}
@@ -85,7 +85,7 @@ int AudioStreamPlaybackMP3::_mix_internal(AudioFrame *p_buffer, int p_frames) {
 		else {
 			//EOF
 			if (use_loop) {
-				seek(mp3_stream->loop_offset);
+				_seek(mp3_stream->loop_offset);
 				loops++;
 			} else {
 				frames_mixed_this_step = p_frames - todo;
@@ -106,6 +106,7 @@ float AudioStreamPlaybackMP3::get_stream_sampling_rate() {
 }
 
 void AudioStreamPlaybackMP3::start(double p_from_pos) {
+	MutexLock lock(decode_mutex);
 	active = true;
 	seek(p_from_pos);
 	loops = 0;
@@ -113,22 +114,38 @@ void AudioStreamPlaybackMP3::start(double p_from_pos) {
 }
 
 void AudioStreamPlaybackMP3::stop() {
+	MutexLock lock(decode_mutex);
 	active = false;
+	stop_decode_ahead();
 }
 
 bool AudioStreamPlaybackMP3::is_playing() const {
-	return active;
+	return active || has_decoded_audio_left();
 }
 
 int AudioStreamPlaybackMP3::get_loop_count() const {
-	return loops;
+	return is_decoding_ahead() ? get_mixed_loop_count() : loops;
 }
 
 double AudioStreamPlaybackMP3::get_playback_position() const {
+	return is_decoding_ahead() ? get_mixed_position() : _get_decoder_position();
+}
+
+double AudioStreamPlaybackMP3::_get_decoder_position() const {
 	return double(frames_mixed) / mp3_stream->sample_rate;
 }
 
+int AudioStreamPlaybackMP3::_get_decoder_loop_count() const {
+	return loops;
+}
+
 void AudioStreamPlaybackMP3::seek(double p_time) {
+	MutexLock lock(decode_mutex);
+	_seek(p_time);
+	discard_decoded_audio();
+}
+
+void AudioStreamPlaybackMP3::_seek(double p_time) {
 	if (!active) {
 		return;
 	}
@@ -147,6 +164,7 @@ void AudioStreamPlaybackMP3::tag_used_streams() {
 
 void AudioStreamPlaybackMP3::set_parameter(const StringName &p_name, const Variant &p_value) {
 	if (p_name == SNAME("looping")) {
+		MutexLock lock(decode_mutex);
 		if (p_value == Variant()) {
 			looping_override = false;
 			looping = false;
@@ -193,6 +211,8 @@ Ref<AudioStreamPlayback> AudioStreamMP3::instantiate_playback() {
 		ERR_FAIL_COND_V(errorcode, Ref<AudioStreamPlaybackMP3>());
 	}
 
+	mp3s->enable_decode_ahead();
+
 	return mp3s;
 }
 
@@ -58,9 +58,13 @@ class AudioStreamPlaybackMP3 : public AudioStreamPlaybackResampled {
 
 	Ref<AudioStreamMP3> mp3_stream;
 
+	void _seek(double p_time);
+
 protected:
 	virtual int _mix_internal(AudioFrame *p_buffer, int p_frames) override;
 	virtual float get_stream_sampling_rate() override;
+	virtual double _get_decoder_position() const override;
+	virtual int _get_decoder_loop_count() const override;
 
 public:
 	virtual void start(double p_from_pos = 0.0) override;
@@ -116,7 +116,7 @@ int AudioStreamPlaybackOggVorbis::_mix_internal(AudioFrame *p_buffer, int p_fram
 					loop_fade_remaining = 0;
 				}
 
-				seek(vorbis_stream->loop_offset);
+				_seek(vorbis_stream->loop_offset);
 				loops++;
 				// We still have buffer to fill, start from this element in the next iteration.
 				continue;
@@ -129,7 +129,7 @@ int AudioStreamPlaybackOggVorbis::_mix_internal(AudioFrame *p_buffer, int p_fram
 			if (use_loop && is_not_empty) {
 				//loop
 
-				seek(vorbis_stream->loop_offset);
+				_seek(vorbis_stream->loop_offset);
 				loops++;
 				// We still have buffer to fill, start from this element in the next iteration.
 
@@ -231,6 +231,7 @@ bool AudioStreamPlaybackOggVorbis::_alloc_vorbis() {
 
 void AudioStreamPlaybackOggVorbis::start(double p_from_pos) {
 	ERR_FAIL_COND(!ready);
+	MutexLock lock(decode_mutex);
 	loop_fade_remaining = FADE_SIZE;
 	active = true;
 	seek(p_from_pos);
@@ -239,27 +240,38 @@ void AudioStreamPlaybackOggVorbis::start(double p_from_pos) {
 }
 
 void AudioStreamPlaybackOggVorbis::stop() {
+	MutexLock lock(decode_mutex);
 	active = false;
+	stop_decode_ahead();
 }
 
 bool AudioStreamPlaybackOggVorbis::is_playing() const {
-	return active;
+	return active || has_decoded_audio_left();
 }
 
 int AudioStreamPlaybackOggVorbis::get_loop_count() const {
-	return loops;
+	return is_decoding_ahead() ? get_mixed_loop_count() : loops;
 }
 
 double AudioStreamPlaybackOggVorbis::get_playback_position() const {
+	return is_decoding_ahead() ? get_mixed_position() : _get_decoder_position();
+}
+
+double AudioStreamPlaybackOggVorbis::_get_decoder_position() const {
 	return double(frames_mixed) / (double)vorbis_data->get_sampling_rate();
 }
 
+int AudioStreamPlaybackOggVorbis::_get_decoder_loop_count() const {
+	return loops;
+}
+
 void AudioStreamPlaybackOggVorbis::tag_used_streams() {
 	vorbis_stream->tag_used(get_playback_position());
 }
 
 void AudioStreamPlaybackOggVorbis::set_parameter(const StringName &p_name, const Variant &p_value) {
 	if (p_name == SNAME("looping")) {
+		MutexLock lock(decode_mutex);
 		if (p_value == Variant()) {
 			looping_override = false;
 			looping = false;
@@ -278,6 +290,12 @@ Variant AudioStreamPlaybackOggVorbis::get_parameter(const StringName &p_name) co
 }
 
 void AudioStreamPlaybackOggVorbis::seek(double p_time) {
+	MutexLock lock(decode_mutex);
+	_seek(p_time);
+	discard_decoded_audio();
+}
+
+void AudioStreamPlaybackOggVorbis::_seek(double p_time) {
 	ERR_FAIL_COND(!ready);
 	ERR_FAIL_COND(vorbis_stream.is_null());
 	if (!active) {
@@ -403,6 +421,7 @@ Ref<AudioStreamPlayback> AudioStreamOggVorbis::instantiate_playback() {
 	ovs->active = false;
 	ovs->loops = 0;
 	if (ovs->_alloc_vorbis()) {
+		ovs->enable_decode_ahead();
 		return ovs;
 	}
 	// Failed to allocate data structures.
@@ -77,6 +77,7 @@ class AudioStreamPlaybackOggVorbis : public AudioStreamPlaybackResampled {
 
 	int _mix_frames(AudioFrame *p_buffer, int p_frames);
 	int _mix_frames_vorbis(AudioFrame *p_buffer, int p_frames);
+	void _seek(double p_time);
 
 	// Allocates vorbis data structures. Returns true upon success, false on failure.
 	bool _alloc_vorbis();
@@ -84,6 +85,8 @@ class AudioStreamPlaybackOggVorbis : public AudioStreamPlaybackResampled {
 protected:
 	virtual int _mix_internal(AudioFrame *p_buffer, int p_frames) override;
 	virtual float get_stream_sampling_rate() override;
+	virtual double _get_decoder_position() const override;
+	virtual int _get_decoder_loop_count() const override;
 
 public:
 	virtual void start(double p_from_pos = 0.0) override;
@@ -0,0 +1,157 @@
+/**************************************************************************/
+/*  test_audio_stream_ogg_vorbis.h                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_AUDIO_STREAM_OGG_VORBIS_H
+#define TEST_AUDIO_STREAM_OGG_VORBIS_H
+
+#include "../audio_stream_ogg_vorbis.h"
+
+#include "tests/servers/test_audio_server.h"
+#include "tests/test_macros.h"
+#include "tests/test_utils.h"
+
+namespace TestAudioStreamOggVorbis {
+
+const int MIX_FRAMES = 512;
+
+// Mixes both playbacks and checks that they produced the same audio and report the same state.
+void check_mix_matches(const Ref<AudioStreamPlayback> &p_playback, const Ref<AudioStreamPlayback> &p_playback_ahead) {
+	AudioFrame buffer[MIX_FRAMES];
+	AudioFrame buffer_ahead[MIX_FRAMES];
+	TestAudioServerInternalsAccessor::decode_ahead(p_playback_ahead);
+	const int mixed = p_playback->mix(buffer, 1.0, MIX_FRAMES);
+	const int mixed_ahead = p_playback_ahead->mix(buffer_ahead, 1.0, MIX_FRAMES);
+	REQUIRE(mixed == mixed_ahead);
+
+	bool same_audio = true;
+	for (int i = 0; i < mixed; i++) {
+		if (!Math::is_equal_approx(buffer[i].l, buffer_ahead[i].l) || !Math::is_equal_approx(buffer[i].r, buffer_ahead[i].r)) {
+			same_audio = false;
+			break;
+		}
+	}
+	CHECK_MESSAGE(same_audio, "Decoding ahead should produce the same audio.");
+	CHECK(Math::is_equal_approx(p_playback->get_playback_position(), p_playback_ahead->get_playback_position()));
+	CHECK(p_playback->get_loop_count() == p_playback_ahead->get_loop_count());
+	CHECK(p_playback->is_playing() == p_playback_ahead->is_playing());
+}
+
+TEST_CASE("[Audio][AudioStreamOggVorbis] Decoding ahead matches decoding in the mix") {
+	Ref<AudioStreamOggVorbis> stream = AudioStreamOggVorbis::load_from_file(TestUtils::get_data_path("audio/sine_440hz_mono.ogg"));
+	REQUIRE(stream.is_valid());
+
+	bool loop = false;
+	SUBCASE("Without looping") {
+		loop = false;
+	}
+	SUBCASE("With looping") {
+		loop = true;
+	}
+	stream->set_loop(loop);
+
+	Ref<AudioStreamPlayback> playback = stream->instantiate_playback();
+	// A playback only decodes ahead if there are decoder threads when it's created. They're finished right away,
+	// and this test does their work between mixes, so the result doesn't depend on timing.
+	TestAudioServerInternalsAccessor::start_decode_ahead_threads(1);
+	Ref<AudioStreamPlayback> playback_ahead = stream->instantiate_playback();
+	TestAudioServerInternalsAccessor::finish_decode_ahead_threads();
+
+	playback->start(0.0);
+	playback_ahead->start(0.0);
+	for (int i = 0; i < 8; i++) {
+		check_mix_matches(playback, playback_ahead);
+	}
+
+	// Chunks decoded before the seek are dropped.
+	playback->seek(0.3);
+	playback_ahead->seek(0.3);
+	CHECK(Math::is_equal_approx(playback->get_playback_position(), playback_ahead->get_playback_position()));
+
+	// The stream is half a second long, this mixes about one second.
+	for (int i = 0; i < 100 && playback->is_playing(); i++) {
+		check_mix_matches(playback, playback_ahead);
+	}
+	if (loop) {
+		CHECK(playback->get_loop_count() > 0);
+		CHECK(playback_ahead->is_playing());
+	} else {
+		CHECK_FALSE(playback->is_playing());
+		CHECK_FALSE(playback_ahead->is_playing());
+	}
+
+	playback->stop();
+	playback_ahead->stop();
+	CHECK_FALSE(playback->is_playing());
+	CHECK_FALSE(playback_ahead->is_playing());
+}
+
+TEST_CASE("[Audio][AudioStreamOggVorbis] Decoder threads play a stream to its end") {
+	Ref<AudioStreamOggVorbis> stream = AudioStreamOggVorbis::load_from_file(TestUtils::get_data_path("audio/sine_440hz_mono.ogg"));
+	REQUIRE(stream.is_valid());
+
+	AudioFrame buffer[MIX_FRAMES];
+	LocalVector<AudioFrame> mixed_in_mix;
+	Ref<AudioStreamPlayback> playback_in_mix = stream->instantiate_playback();
+	playback_in_mix->start(0.0);
+	for (int i = 0; i < 1000 && playback_in_mix->is_playing(); i++) {
+		playback_in_mix->mix(buffer, 1.0, MIX_FRAMES);
+		for (int j = 0; j < MIX_FRAMES; j++) {
+			mixed_in_mix.push_back(buffer[j]);
+		}
+	}
+
+	TestAudioServerInternalsAccessor::start_decode_ahead_threads(2);
+	Ref<AudioStreamPlayback> playback = stream->instantiate_playback();
+	playback->start(0.0);
+
+	LocalVector<AudioFrame> mixed;
+	for (int i = 0; i < 1000 && playback->is_playing(); i++) {
+		playback->mix(buffer, 1.0, MIX_FRAMES);
+		for (int j = 0; j < MIX_FRAMES; j++) {
+			mixed.push_back(buffer[j]);
+		}
+		OS::get_singleton()->delay_usec(1000);
+	}
+	CHECK_FALSE(playback->is_playing());
+	// Chunks the decoder threads didn't finish in time are decoded by the mix instead, so the output is the same.
+	REQUIRE(mixed.size() == mixed_in_mix.size());
+	bool same_output = true;
+	for (uint32_t i = 0; i < mixed.size(); i++) {
+		same_output = same_output && mixed[i].left == mixed_in_mix[i].left && mixed[i].right == mixed_in_mix[i].right;
+	}
+	CHECK(same_output);
+	CHECK(Math::is_equal_approx(playback->get_playback_position(), playback_in_mix->get_playback_position()));
+
+	TestAudioServerInternalsAccessor::finish_decode_ahead_threads();
+}
+
+} // namespace TestAudioStreamOggVorbis
+
+#endif // TEST_AUDIO_STREAM_OGG_VORBIS_H
@@ -72,13 +72,16 @@ future: no idea
 Node3DGizmo::Node3DGizmo() {
 }
 
-void Node3D::_notify_dirty() {
+bool Node3D::_is_transform_notification_needed() const {
 #ifdef TOOLS_ENABLED
-	if ((!data.gizmos.is_empty() || data.notify_transform) && !data.ignore_notification && !xform_change.in_list()) {
+	return (!data.gizmos.is_empty() || data.notify_transform) && !data.ignore_notification;
 #else
-	if (data.notify_transform && !data.ignore_notification && !xform_change.in_list()) {
-
+	return data.notify_transform && !data.ignore_notification;
 #endif
+}
+
+void Node3D::_notify_dirty() {
+	if (_is_transform_notification_needed() && !xform_change.in_list()) {
 		get_tree()->xform_change_list.add(&xform_change);
 	}
 }
@@ -108,17 +111,22 @@ void Node3D::_propagate_transform_changed(Node3D *p_origin) {
 		return;
 	}
 
+	bool notification_needed = _is_transform_notification_needed();
+
+	// A node whose global transform is still dirty has not been read since it was last dirtied, and since reading it
+	// reads all of its parents, its whole subtree is still dirty too. Moving many nodes of a deep hierarchy in the
+	// same frame then only walks each subtree once.
+	if (p_origin != this && _test_dirty_bits(DIRTY_GLOBAL_TRANSFORM) && (!notification_needed || xform_change.in_list())) {
+		return;
+	}
+
 	for (Node3D *&E : data.children) {
 		if (E->data.top_level) {
 			continue; //don't propagate to a top_level
 		}
 		E->_propagate_transform_changed(p_origin);
 	}
-#ifdef TOOLS_ENABLED
-	if ((!data.gizmos.is_empty() || data.notify_transform) && !data.ignore_notification && !xform_change.in_list()) {
-#else
-	if (data.notify_transform && !data.ignore_notification && !xform_change.in_list()) {
-#endif
+	if (notification_needed && !xform_change.in_list()) {
 		if (likely(is_accessible_from_caller_thread())) {
 			get_tree()->xform_change_list.add(&xform_change);
 		} else {
@@ -217,6 +225,11 @@ void Node3D::_notification(int p_what) {
 		case NOTIFICATION_TRANSFORM_CHANGED: {
 			ERR_THREAD_GUARD;
 
+			if (is_inside_tree()) {
+				// Update the global transform now, so the subtree can be dirtied again in a single walk (see _propagate_transform_changed()).
+				(void)get_global_transform();
+			}
+
 #ifdef TOOLS_ENABLED
 			for (int i = 0; i < data.gizmos.size(); i++) {
 				data.gizmos.write[i]->transform();
@@ -616,6 +629,9 @@ void Node3D::add_gizmo(Ref<Node3DGizmo> p_gizmo) {
 		}
 		p_gizmo->transform();
 	}
+	if (is_inside_tree() && _test_dirty_bits(DIRTY_GLOBAL_TRANSFORM)) {
+		_notify_dirty(); // Not queued when it was dirtied, as it had no gizmos then.
+	}
 #endif
 }
 
@@ -745,6 +761,7 @@ void Node3D::set_as_top_level(bool p_enabled) {
 		}
 	}
 	data.top_level = p_enabled;
+	_propagate_transform_changed(this); // Its global transform now depends on the parent's, or stopped to.
 }
 
 bool Node3D::is_set_as_top_level() const {
@@ -953,6 +970,9 @@ Vector3 Node3D::to_global(Vector3 p_local) const {
 void Node3D::set_notify_transform(bool p_enabled) {
 	ERR_THREAD_GUARD;
 	data.notify_transform = p_enabled;
+	if (p_enabled && is_inside_tree() && _test_dirty_bits(DIRTY_GLOBAL_TRANSFORM)) {
+		_notify_dirty(); // Not queued when it was dirtied, as no notification was needed then.
+	}
 }
 
 bool Node3D::is_transform_notification_enabled() const {
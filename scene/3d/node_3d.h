@@ -135,6 +135,7 @@ private:
 	void _clear_dirty_bits(uint32_t p_bits) const;
 
 	void _update_gizmos();
+	bool _is_transform_notification_needed() const;
 	void _notify_dirty();
 	void _propagate_transform_changed(Node3D *p_origin);
 
@@ -206,6 +206,7 @@ void Skeleton3D::_update_process_order() {
 	int len = bones.size();
 
 	parentless_bones.clear();
+	bone_process_order.clear();
 
 	for (int i = 0; i < len; i++) {
 		bonesptr[i].child_bones.clear();
@@ -233,6 +234,18 @@ void Skeleton3D::_update_process_order() {
 		}
 	}
 
+	// Breadth first from each root, the same order the bones used to be updated in.
+	for (int i = 0; i < parentless_bones.size(); i++) {
+		uint32_t from = bone_process_order.size();
+		bone_process_order.push_back(parentless_bones[i]);
+		for (uint32_t j = from; j < bone_process_order.size(); j++) {
+			const Vector<int> &children = bonesptr[bone_process_order[j]].child_bones;
+			for (int k = 0; k < children.size(); k++) {
+				bone_process_order.push_back(children[k]);
+			}
+		}
+	}
+
 	process_order_dirty = false;
 }
 
@@ -251,7 +264,7 @@ void Skeleton3D::_notification(int p_what) {
 			dirty = false;
 
 			// Update bone transforms.
-			force_update_all_bone_transforms();
+			_update_bone_transforms(false);
 
 			// Update skins.
 			for (SkinReference *E : skin_bindings) {
@@ -259,7 +272,11 @@ void Skeleton3D::_notification(int p_what) {
 				RID skeleton = E->skeleton;
 				uint32_t bind_count = skin->get_bind_count();
 
+				// Otherwise, only the binds of bones that moved are sent.
+				bool update_all_binds = false;
+
 				if (E->bind_count != bind_count) {
+					update_all_binds = true;
 					RS::get_singleton()->skeleton_allocate_data(skeleton, bind_count);
 					E->bind_count = bind_count;
 					E->skin_bone_indices.resize(bind_count);
@@ -300,14 +317,18 @@ void Skeleton3D::_notification(int p_what) {
 					}
 
 					E->skeleton_version = version;
+					update_all_binds = true;
 				}
 
 				for (uint32_t i = 0; i < bind_count; i++) {
 					uint32_t bone_index = E->skin_bone_indices_ptrs[i];
 					ERR_CONTINUE(bone_index >= (uint32_t)len);
-					rs->skeleton_bone_set_transform(skeleton, i, bonesptr[bone_index].pose_global * skin->get_bind_pose(i));
+					if (update_all_binds || bonesptr[bone_index].pose_global_pass > skin_update_pass) {
+						rs->skeleton_bone_set_transform(skeleton, i, bonesptr[bone_index].pose_global * skin->get_bind_pose(i));
+					}
 				}
 			}
+			skin_update_pass = update_pass;
 			emit_signal(SceneStringNames::get_singleton()->pose_updated);
 		} break;
 
@@ -572,30 +593,36 @@ void Skeleton3D::set_bone_pose_position(int p_bone, const Vector3 &p_position) {
 	const int bone_size = bones.size();
 	ERR_FAIL_INDEX(p_bone, bone_size);
 
-	bones.write[p_bone].pose_position = p_position;
-	bones.write[p_bone].pose_cache_dirty = true;
+	Bone &bone = bones.write[p_bone];
+	bone.pose_position = p_position;
+	bone.pose_cache_dirty = true;
+	bone.pose_global_dirty = true;
 	if (is_inside_tree()) {
-		_make_dirty();
+		_queue_update();
 	}
 }
 void Skeleton3D::set_bone_pose_rotation(int p_bone, const Quaternion &p_rotation) {
 	const int bone_size = bones.size();
 	ERR_FAIL_INDEX(p_bone, bone_size);
 
-	bones.write[p_bone].pose_rotation = p_rotation;
-	bones.write[p_bone].pose_cache_dirty = true;
+	Bone &bone = bones.write[p_bone];
+	bone.pose_rotation = p_rotation;
+	bone.pose_cache_dirty = true;
+	bone.pose_global_dirty = true;
 	if (is_inside_tree()) {
-		_make_dirty();
+		_queue_update();
 	}
 }
 void Skeleton3D::set_bone_pose_scale(int p_bone, const Vector3 &p_scale) {
 	const int bone_size = bones.size();
 	ERR_FAIL_INDEX(p_bone, bone_size);
 
-	bones.write[p_bone].pose_scale = p_scale;
-	bones.write[p_bone].pose_cache_dirty = true;
+	Bone &bone = bones.write[p_bone];
+	bone.pose_scale = p_scale;
+	bone.pose_cache_dirty = true;
+	bone.pose_global_dirty = true;
 	if (is_inside_tree()) {
-		_make_dirty();
+		_queue_update();
 	}
 }
 
@@ -639,6 +666,11 @@ Transform3D Skeleton3D::get_bone_pose(int p_bone) const {
 }
 
 void Skeleton3D::_make_dirty() {
+	all_bones_dirty = true;
+	_queue_update();
+}
+
+void Skeleton3D::_queue_update() {
 	if (dirty) {
 		return;
 	}
@@ -913,11 +945,25 @@ void Skeleton3D::force_update_all_dirty_bones() {
 }
 
 void Skeleton3D::force_update_all_bone_transforms() {
+	_update_bone_transforms(true);
+}
+
+void Skeleton3D::_update_bone_transforms(bool p_force) {
 	_update_process_order();
 
-	for (int i = 0; i < parentless_bones.size(); i++) {
-		force_update_bone_children_transforms(parentless_bones[i]);
+	const bool update_all = p_force || all_bones_dirty || rest_dirty;
+	update_pass++;
+
+	Bone *bonesptr = bones.ptrw();
+	for (const int bone_idx : bone_process_order) {
+		const Bone &b = bonesptr[bone_idx];
+		// A bone is updated when its own pose changed, its parent was updated, or it's being overridden.
+		if (update_all || b.pose_global_dirty || b.global_pose_override_amount >= CMP_EPSILON || (b.parent >= 0 && bonesptr[b.parent].pose_global_pass == update_pass)) {
+			_update_bone_global_pose(bonesptr, bone_idx);
+		}
 	}
+
+	all_bones_dirty = false;
 	rest_dirty = false;
 }
 
@@ -925,57 +971,66 @@ void Skeleton3D::force_update_bone_children_transforms(int p_bone_idx) {
 	const int bone_size = bones.size();
 	ERR_FAIL_INDEX(p_bone_idx, bone_size);
 
+	// Bones updated here still have to be sent to the skins on the next update.
+	update_pass++;
+
 	Bone *bonesptr = bones.ptrw();
-	List<int> bones_to_process = List<int>();
+	LocalVector<int> bones_to_process;
 	bones_to_process.push_back(p_bone_idx);
 
-	while (bones_to_process.size() > 0) {
-		int current_bone_idx = bones_to_process[0];
-		bones_to_process.erase(current_bone_idx);
+	for (uint32_t i = 0; i < bones_to_process.size(); i++) {
+		const int current_bone_idx = bones_to_process[i];
+		_update_bone_global_pose(bonesptr, current_bone_idx);
 
-		Bone &b = bonesptr[current_bone_idx];
-		bool bone_enabled = b.enabled && !show_rest_only;
+		// Add the bone's children to the list of bones to be processed.
+		const Vector<int> &children = bonesptr[current_bone_idx].child_bones;
+		for (int j = 0; j < children.size(); j++) {
+			bones_to_process.push_back(children[j]);
+		}
+	}
+}
 
-		if (bone_enabled) {
-			b.update_pose_cache();
-			Transform3D pose = b.pose_cache;
+void Skeleton3D::_update_bone_global_pose(Bone *p_bones, int p_bone) {
+	Bone &b = p_bones[p_bone];
+	bool bone_enabled = b.enabled && !show_rest_only;
 
-			if (b.parent >= 0) {
-				b.pose_global = bonesptr[b.parent].pose_global * pose;
-				b.pose_global_no_override = bonesptr[b.parent].pose_global_no_override * pose;
-			} else {
-				b.pose_global = pose;
-				b.pose_global_no_override = pose;
-			}
+	if (bone_enabled) {
+		b.update_pose_cache();
+		Transform3D pose = b.pose_cache;
+
+		if (b.parent >= 0) {
+			b.pose_global = p_bones[b.parent].pose_global * pose;
+			b.pose_global_no_override = p_bones[b.parent].pose_global_no_override * pose;
 		} else {
-			if (b.parent >= 0) {
-				b.pose_global = bonesptr[b.parent].pose_global * b.rest;
-				b.pose_global_no_override = bonesptr[b.parent].pose_global_no_override * b.rest;
-			} else {
-				b.pose_global = b.rest;
-				b.pose_global_no_override = b.rest;
-			}
-		}
-		if (rest_dirty) {
-			b.global_rest = b.parent >= 0 ? bonesptr[b.parent].global_rest * b.rest : b.rest;
+			b.pose_global = pose;
+			b.pose_global_no_override = pose;
 		}
-
-		if (b.global_pose_override_amount >= CMP_EPSILON) {
-			b.pose_global = b.pose_global.interpolate_with(b.global_pose_override, b.global_pose_override_amount);
+	} else {
+		if (b.parent >= 0) {
+			b.pose_global = p_bones[b.parent].pose_global * b.rest;
+			b.pose_global_no_override = p_bones[b.parent].pose_global_no_override * b.rest;
+		} else {
+			b.pose_global = b.rest;
+			b.pose_global_no_override = b.rest;
 		}
+	}
+	if (rest_dirty) {
+		b.global_rest = b.parent >= 0 ? p_bones[b.parent].global_rest * b.rest : b.rest;
+	}
 
-		if (b.global_pose_override_reset) {
-			b.global_pose_override_amount = 0.0;
-		}
+	if (b.global_pose_override_amount >= CMP_EPSILON) {
+		b.pose_global = b.pose_global.interpolate_with(b.global_pose_override, b.global_pose_override_amount);
+	}
 
-		// Add the bone's children to the list of bones to be processed.
-		int child_bone_size = b.child_bones.size();
-		for (int i = 0; i < child_bone_size; i++) {
-			bones_to_process.push_back(b.child_bones[i]);
-		}
+	// A reset override still has to be removed by the next update.
+	b.pose_global_dirty = b.global_pose_override_reset && b.global_pose_override_amount >= CMP_EPSILON;
+	b.pose_global_pass = update_pass;
 
-		emit_signal(SceneStringNames::get_singleton()->bone_pose_changed, current_bone_idx);
+	if (b.global_pose_override_reset) {
+		b.global_pose_override_amount = 0.0;
 	}
+
+	emit_signal(SceneStringNames::get_singleton()->bone_pose_changed, p_bone);
 }
 
 void Skeleton3D::_bind_methods() {
@@ -93,6 +93,8 @@ private:
 
 		Transform3D pose_global;
 		Transform3D pose_global_no_override;
+		bool pose_global_dirty = true; // The pose changed since the global pose was last computed.
+		uint64_t pose_global_pass = 0; // The update in which the global pose was last computed.
 
 		real_t global_pose_override_amount = 0.0;
 		bool global_pose_override_reset = false;
@@ -125,11 +127,19 @@ private:
 	bool process_order_dirty = false;
 
 	Vector<int> parentless_bones;
+	LocalVector<int> bone_process_order; // Every bone, after its parent.
 	HashMap<String, int> name_to_bone_index;
 
 	void _make_dirty();
+	void _queue_update();
 	bool dirty = false;
 	bool rest_dirty = false;
+	bool all_bones_dirty = true; // Otherwise only bones marked with pose_global_dirty, and their children, are updated.
+	uint64_t update_pass = 0;
+	uint64_t skin_update_pass = 0; // Last pass whose bone poses were sent to the skins.
+
+	void _update_bone_global_pose(Bone *p_bones, int p_bone);
+	void _update_bone_transforms(bool p_force);
 
 	bool show_rest_only = false;
 	float motion_scale = 1.0;
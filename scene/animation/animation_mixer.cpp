@@ -32,10 +32,14 @@
 #include "animation_mixer.compat.inc"
 
 #include "core/config/engine.h"
+#include "core/config/project_settings.h"
+#include "core/os/spin_lock.h"
+#include "scene/3d/camera_3d.h"
 #include "scene/3d/mesh_instance_3d.h"
 #include "scene/3d/node_3d.h"
 #include "scene/3d/skeleton_3d.h"
 #include "scene/animation/animation_player.h"
+#include "scene/main/viewport.h"
 #include "scene/resources/animation.h"
 #include "scene/scene_string_names.h"
 #include "servers/audio/audio_stream.h"
@@ -45,6 +49,68 @@
 #include "editor/editor_undo_redo_manager.h"
 #endif // TOOLS_ENABLED
 
+// Samples taken during the current frame by the mixers that enable shared sampling, so instances
+// playing the same animation in sync sample each track only once. It's direct-mapped: it never
+// allocates, and a sample that maps to a taken slot replaces the one there.
+class AnimationSharedSamples {
+	static constexpr uint32_t SLOT_COUNT = 4096;
+	static constexpr uint32_t LOCK_COUNT = 64;
+
+	// Trivial, so the slots are zero-initialized without touching them; a zero frame means empty.
+	struct Slot {
+		uint64_t frame;
+		uint64_t animation;
+		int track;
+		double time;
+		real_t value[4];
+	};
+
+	Slot slots[SLOT_COUNT];
+	SpinLock locks[LOCK_COUNT];
+
+	static uint32_t _get_index(uint64_t p_animation, int p_track, double p_time) {
+		uint32_t h = hash_murmur3_one_64(p_animation);
+		h = hash_murmur3_one_32(p_track, h);
+		h = hash_murmur3_one_double(p_time, h);
+		return hash_fmix32(h) & (SLOT_COUNT - 1);
+	}
+
+public:
+	template <class T>
+	bool get(ObjectID p_animation, int p_track, double p_time, T *r_value) {
+		static_assert(sizeof(T) <= sizeof(Slot::value));
+		const uint64_t frame = Engine::get_singleton()->get_process_frames() + 1;
+		const uint32_t idx = _get_index(p_animation, p_track, p_time);
+		const Slot &slot = slots[idx];
+
+		SpinLock &lock = locks[idx % LOCK_COUNT];
+		lock.lock();
+		bool found = slot.frame == frame && slot.animation == (uint64_t)p_animation && slot.track == p_track && slot.time == p_time;
+		if (found) {
+			memcpy((void *)r_value, slot.value, sizeof(T));
+		}
+		lock.unlock();
+		return found;
+	}
+
+	template <class T>
+	void set(ObjectID p_animation, int p_track, double p_time, const T &p_value) {
+		const uint32_t idx = _get_index(p_animation, p_track, p_time);
+		Slot &slot = slots[idx];
+
+		SpinLock &lock = locks[idx % LOCK_COUNT];
+		lock.lock();
+		slot.frame = Engine::get_singleton()->get_process_frames() + 1;
+		slot.animation = p_animation;
+		slot.track = p_track;
+		slot.time = p_time;
+		memcpy(slot.value, (const void *)&p_value, sizeof(T));
+		lock.unlock();
+	}
+};
+
+static AnimationSharedSamples animation_shared_samples;
+
 bool AnimationMixer::_set(const StringName &p_name, const Variant &p_value) {
 	String name = p_name;
 
@@ -465,6 +531,39 @@ bool AnimationMixer::is_deterministic() const {
 	return deterministic;
 }
 
+void AnimationMixer::set_threaded_blending_enabled(bool p_enabled) {
+	threaded_blending = p_enabled;
+}
+
+bool AnimationMixer::is_threaded_blending_enabled() const {
+	return threaded_blending;
+}
+
+void AnimationMixer::set_shared_sampling_enabled(bool p_enabled) {
+	shared_sampling = p_enabled;
+}
+
+bool AnimationMixer::is_shared_sampling_enabled() const {
+	return shared_sampling;
+}
+
+void AnimationMixer::set_lod_level(LODLevel p_level) {
+	ERR_FAIL_INDEX(p_level, LOD_LEVEL_MAX);
+	lod_level = p_level;
+}
+
+AnimationMixer::LODLevel AnimationMixer::get_lod_level() const {
+	return lod_level;
+}
+
+void AnimationMixer::set_lod_use_camera_distance(bool p_enabled) {
+	lod_use_camera_distance = p_enabled;
+}
+
+bool AnimationMixer::is_lod_using_camera_distance() const {
+	return lod_use_camera_distance;
+}
+
 void AnimationMixer::set_callback_mode_process(AnimationCallbackModeProcess p_mode) {
 	if (callback_mode_process == p_mode) {
 		return;
@@ -551,6 +650,8 @@ void AnimationMixer::_clear_caches() {
 		memdelete(K.value);
 	}
 	track_cache.clear();
+	track_bindings.clear();
+	_build_transform_buffers();
 	cache_valid = false;
 
 	emit_signal(SNAME("caches_cleared"));
@@ -588,6 +689,7 @@ void AnimationMixer::_init_root_motion_cache() {
 
 bool AnimationMixer::_update_caches() {
 	setup_pass++;
+	track_bindings.clear();
 
 	root_motion_cache.loc = Vector3(0, 0, 0);
 	root_motion_cache.rot = Quaternion(0, 0, 0, 1);
@@ -903,6 +1005,8 @@ bool AnimationMixer::_update_caches() {
 
 	track_count = idx;
 
+	_build_transform_buffers();
+
 	cache_valid = true;
 
 	return true;
@@ -923,6 +1027,98 @@ void AnimationMixer::_process_animation(double p_delta, bool p_update_only) {
 	clear_animation_instances();
 }
 
+bool AnimationMixer::_can_blend_threaded() {
+	// Sub-threaded process groups already run away from the main thread, and script overrides of
+	// _post_process_key_value() can't be called from the worker threads.
+	return threaded_blending && is_inside_tree() && Thread::is_main_thread() && !GDVIRTUAL_IS_OVERRIDDEN(_post_process_key_value);
+}
+
+void AnimationMixer::_update_lod_level_from_camera() {
+#ifndef _3D_DISABLED
+	if (!lod_use_camera_distance || !is_inside_tree()) {
+		return;
+	}
+	const Node3D *root = Object::cast_to<Node3D>(get_node_or_null(root_node));
+	const Camera3D *camera = get_viewport()->get_camera_3d();
+	if (!root || !camera) {
+		return;
+	}
+	const real_t distance_squared = camera->get_global_position().distance_squared_to(root->get_global_position());
+	lod_level = LOD_LEVEL_FULL;
+	for (int i = LOD_LEVEL_MAX - 1; i > LOD_LEVEL_FULL; i--) {
+		if (distance_squared >= lod_distance[i] * lod_distance[i]) {
+			lod_level = LODLevel(i);
+			break;
+		}
+	}
+#endif // _3D_DISABLED
+}
+
+bool AnimationMixer::_lod_consume_delta(double &r_delta) {
+	_update_lod_level_from_camera();
+
+	const double interval = lod_update_interval[lod_level];
+	lod_accumulated_delta += r_delta;
+	if (lod_accumulated_delta < interval) {
+		return false; // Skip this frame, the time is made up for by the next update.
+	}
+	r_delta = lod_accumulated_delta;
+	lod_accumulated_delta = 0.0;
+	return true;
+}
+
+bool AnimationMixer::_is_track_culled(Animation::TrackType p_type) const {
+	const uint32_t culled = lod_culled_tracks[lod_level];
+	if (likely(culled == 0)) {
+		return false;
+	}
+	switch (p_type) {
+		case Animation::TYPE_BLEND_SHAPE:
+			return culled & LOD_CULL_BLEND_SHAPE;
+		case Animation::TYPE_AUDIO:
+			return culled & LOD_CULL_AUDIO;
+		case Animation::TYPE_METHOD:
+			return culled & LOD_CULL_METHOD;
+		default:
+			return false;
+	}
+}
+
+void AnimationMixer::_queue_threaded_blend(double p_delta) {
+	// Everything that can trigger user code runs now, in tree order, as it does when not threaded.
+	_blend_init();
+	if (!_blend_pre_process(p_delta, track_count, track_map)) {
+		clear_animation_instances();
+		return;
+	}
+	_blend_calc_total_weight();
+	_blend_process(p_delta, false, BLEND_PASS_TRIGGERED);
+
+	threaded_blend_delta = p_delta;
+	threaded_blend_queued = true;
+	get_tree()->threaded_animation_mixers.push_back(this);
+}
+
+void AnimationMixer::_blend_threaded() {
+	_blend_process(threaded_blend_delta, false, BLEND_PASS_SAMPLED);
+}
+
+void AnimationMixer::_apply_threaded_blend() {
+	threaded_blend_queued = false;
+	_blend_apply();
+	_blend_post_process();
+	clear_animation_instances();
+}
+
+void AnimationMixer::_cancel_threaded_blend() {
+	if (!threaded_blend_queued) {
+		return;
+	}
+	threaded_blend_queued = false;
+	get_tree()->_remove_threaded_animation_mixer(this);
+	clear_animation_instances();
+}
+
 Variant AnimationMixer::post_process_key_value(const Ref<Animation> &p_anim, int p_track, Variant p_value, ObjectID p_object_id, int p_object_sub_idx) {
 	Variant res;
 	if (GDVIRTUAL_CALL(_post_process_key_value, p_anim, p_track, p_value, p_object_id, p_object_sub_idx, res)) {
@@ -968,6 +1164,9 @@ void AnimationMixer::_blend_init() {
 	// Init all value/transform/blend/bezier tracks that track_cache has.
 	for (const KeyValue<Animation::TypeHash, TrackCache *> &K : track_cache) {
 		TrackCache *track = K.value;
+		if (_is_track_culled(track->type)) {
+			continue; // Keep the last result, it's not blended at this level of detail.
+		}
 
 		track->total_weight = 0.0;
 
@@ -982,6 +1181,9 @@ void AnimationMixer::_blend_init() {
 				t->loc = t->init_loc;
 				t->rot = t->init_rot;
 				t->scale = t->init_scale;
+				transform_buffers.loc[t->transform_idx] = t->init_loc;
+				transform_buffers.rot[t->transform_idx] = t->init_rot;
+				transform_buffers.scale[t->transform_idx] = t->init_scale;
 			} break;
 			case Animation::TYPE_BLEND_SHAPE: {
 				TrackCacheBlendShape *t = static_cast<TrackCacheBlendShape *>(track);
@@ -1013,34 +1215,164 @@ void AnimationMixer::_blend_post_process() {
 	//
 }
 
+LocalVector<AnimationMixer::TrackBinding> &AnimationMixer::_get_track_bindings(const Ref<Animation> &p_animation) {
+	const int anim_track_count = p_animation->get_track_count();
+	LocalVector<TrackBinding> *bindings = track_bindings.getptr(p_animation->get_instance_id());
+	if (bindings && (int)bindings->size() == anim_track_count) {
+		return *bindings;
+	}
+	if (!bindings) {
+		bindings = &track_bindings.insert(p_animation->get_instance_id(), LocalVector<TrackBinding>())->value;
+	}
+
+	bindings->resize(anim_track_count);
+	for (int i = 0; i < anim_track_count; i++) {
+		TrackBinding &binding = (*bindings)[i];
+		binding = TrackBinding();
+		TrackCache **track = track_cache.getptr(p_animation->track_get_type_hash(i));
+		if (!track) {
+			continue;
+		}
+		binding.track = *track;
+		const int *blend_idx = track_map.getptr(binding.track->path);
+		if (blend_idx) {
+			binding.blend_idx = *blend_idx;
+		}
+	}
+	return *bindings;
+}
+
+void AnimationMixer::_build_transform_buffers() {
+	TransformBlendBuffers &buffers = transform_buffers;
+	buffers.tracks.clear();
+	buffers.init_loc.clear();
+	buffers.init_rot_inv.clear();
+	buffers.init_scale.clear();
+	for (const KeyValue<Animation::TypeHash, TrackCache *> &K : track_cache) {
+		if (K.value->type != Animation::TYPE_POSITION_3D) {
+			continue;
+		}
+		TrackCacheTransform *t = static_cast<TrackCacheTransform *>(K.value);
+		t->transform_idx = buffers.tracks.size();
+		buffers.tracks.push_back(t);
+		buffers.init_loc.push_back(t->init_loc);
+		buffers.init_rot_inv.push_back(t->init_rot.inverse());
+		buffers.init_scale.push_back(t->init_scale);
+	}
+	buffers.loc.resize(buffers.tracks.size());
+	buffers.rot.resize(buffers.tracks.size());
+	buffers.scale.resize(buffers.tracks.size());
+}
+
+void AnimationMixer::_blend_vector3_samples(const TransformSampleBatch<Vector3> &p_samples, const Vector3 *p_init, Vector3 *r_values) {
+	const uint32_t *indices = p_samples.indices.ptr();
+	const Vector3 *values = p_samples.values.ptr();
+	const real_t *weights = p_samples.weights.ptr();
+	const uint32_t count = p_samples.indices.size();
+	for (uint32_t i = 0; i < count; i++) {
+		const uint32_t idx = indices[i];
+		r_values[idx] += (values[i] - p_init[idx]) * weights[i];
+	}
+}
+
+void AnimationMixer::_blend_rotation_samples(const TransformSampleBatch<Quaternion> &p_samples, const Quaternion *p_init_inv, Quaternion *r_values) {
+	const uint32_t *indices = p_samples.indices.ptr();
+	const Quaternion *values = p_samples.values.ptr();
+	const real_t *weights = p_samples.weights.ptr();
+	const uint32_t count = p_samples.indices.size();
+	for (uint32_t i = 0; i < count; i++) {
+		const uint32_t idx = indices[i];
+		r_values[idx] = (r_values[idx] * Quaternion().slerp(p_init_inv[idx] * values[i], weights[i])).normalized();
+	}
+}
+
+void AnimationMixer::_blend_transform_samples() {
+	// Samples keep the order of the tracks, so several tracks blending into the same transform give the same result as blending them one by one.
+	_blend_vector3_samples(position_samples, transform_buffers.init_loc.ptr(), transform_buffers.loc.ptr());
+	_blend_rotation_samples(rotation_samples, transform_buffers.init_rot_inv.ptr(), transform_buffers.rot.ptr());
+	_blend_vector3_samples(scale_samples, transform_buffers.init_scale.ptr(), transform_buffers.scale.ptr());
+	position_samples.clear();
+	rotation_samples.clear();
+	scale_samples.clear();
+}
+
+void AnimationMixer::_copy_transform_buffers_to_caches() {
+	TransformBlendBuffers &buffers = transform_buffers;
+	for (uint32_t i = 0; i < buffers.tracks.size(); i++) {
+		TrackCacheTransform *t = buffers.tracks[i];
+		t->loc = buffers.loc[i];
+		t->rot = buffers.rot[i];
+		t->scale = buffers.scale[i];
+	}
+}
+
+template <class T>
+Error AnimationMixer::_sample_track(Error (Animation::*p_sample)(int, double, T *, int *) const, const Ref<Animation> &p_animation, int p_track, double p_time, int *r_cursor, T *r_value) {
+	if (!shared_sampling) {
+		return (p_animation.ptr()->*p_sample)(p_track, p_time, r_value, r_cursor);
+	}
+
+	const ObjectID animation_id = p_animation->get_instance_id();
+	if (animation_shared_samples.get(animation_id, p_track, p_time, r_value)) {
+		return OK;
+	}
+	Error err = (p_animation.ptr()->*p_sample)(p_track, p_time, r_value, r_cursor);
+	if (err == OK) {
+		animation_shared_samples.set(animation_id, p_track, p_time, *r_value);
+	}
+	return err;
+}
+
 void AnimationMixer::_blend_calc_total_weight() {
+	if ((int)blend_idx_passes.size() != track_count) {
+		blend_idx_passes.resize(track_count);
+		for (uint64_t &pass : blend_idx_passes) {
+			pass = 0;
+		}
+	}
+
 	for (const AnimationInstance &ai : animation_instances) {
 		Ref<Animation> a = ai.animation_data.animation;
 		real_t weight = ai.playback_info.weight;
-		Vector<real_t> track_weights = ai.playback_info.track_weights;
-		Vector<int> processed_indices;
+		const Vector<real_t> &track_weights = ai.playback_info.track_weights;
+		const LocalVector<TrackBinding> &bindings = _get_track_bindings(a);
+		weight_pass++;
 		for (int i = 0; i < a->get_track_count(); i++) {
 			if (!a->track_is_enabled(i)) {
 				continue;
 			}
-			Animation::TypeHash thash = a->track_get_type_hash(i);
-			if (!track_cache.has(thash)) {
+			TrackCache *track = bindings[i].track;
+			if (!track) {
 				continue; // No path, but avoid error spamming.
 			}
-			TrackCache *track = track_cache[thash];
-			int blend_idx = track_map[track->path];
-			if (processed_indices.has(blend_idx)) {
-				continue; // There is the case different track type with same path... Is there more faster iterating way than has()?
-			}
+			int blend_idx = bindings[i].blend_idx;
 			ERR_CONTINUE(blend_idx < 0 || blend_idx >= track_count);
+			if (blend_idx_passes[blend_idx] == weight_pass) {
+				continue; // There is the case different track type with same path.
+			}
 			real_t blend = blend_idx < track_weights.size() ? track_weights[blend_idx] * weight : weight;
 			track->total_weight += blend;
-			processed_indices.push_back(blend_idx);
+			blend_idx_passes[blend_idx] = weight_pass;
 		}
 	}
 }
 
-void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
+bool AnimationMixer::_is_sampled_track(Animation::TrackType p_type, const TrackCache *p_track) {
+	switch (p_type) {
+		case Animation::TYPE_POSITION_3D:
+		case Animation::TYPE_ROTATION_3D:
+		case Animation::TYPE_SCALE_3D:
+		case Animation::TYPE_BLEND_SHAPE:
+			return true;
+		case Animation::TYPE_VALUE:
+		case Animation::TYPE_BEZIER:
+			return static_cast<const TrackCacheValue *>(p_track)->is_continuous;
+		default:
+			return false;
+	}
+}
+
+void AnimationMixer::_blend_process(double p_delta, bool p_update_only, BlendPass p_pass) {
 	// Apply value/transform/blend/bezier blends to track caches and execute method/audio/animation tracks.
 #ifdef TOOLS_ENABLED
 	bool can_call = is_inside_tree() && !Engine::get_singleton()->is_editor_hint();
@@ -1053,7 +1385,8 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 		Animation::LoopedFlag looped_flag = ai.playback_info.looped_flag;
 		bool is_external_seeking = ai.playback_info.is_external_seeking;
 		real_t weight = ai.playback_info.weight;
-		Vector<real_t> track_weights = ai.playback_info.track_weights;
+		const Vector<real_t> &track_weights = ai.playback_info.track_weights;
+		LocalVector<TrackBinding> &bindings = _get_track_bindings(a);
 		bool backward = signbit(delta); // This flag is used by the root motion calculates or detecting the end of audio stream.
 #ifndef _3D_DISABLED
 		bool calc_root = !seeked || is_external_seeking;
@@ -1063,13 +1396,11 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 			if (!a->track_is_enabled(i)) {
 				continue;
 			}
-			Animation::TypeHash thash = a->track_get_type_hash(i);
-			if (!track_cache.has(thash)) {
+			TrackCache *track = bindings[i].track;
+			if (!track) {
 				continue; // No path, but avoid error spamming.
 			}
-			TrackCache *track = track_cache[thash];
-			ERR_CONTINUE(!track_map.has(track->path));
-			int blend_idx = track_map[track->path];
+			int blend_idx = bindings[i].blend_idx;
 			ERR_CONTINUE(blend_idx < 0 || blend_idx >= track_count);
 			real_t blend = blend_idx < track_weights.size() ? track_weights[blend_idx] * weight : weight;
 			if (!deterministic) {
@@ -1081,6 +1412,12 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 				blend = blend / track->total_weight;
 			}
 			Animation::TrackType ttype = a->track_get_type(i);
+			if (_is_track_culled(ttype)) {
+				continue;
+			}
+			if (p_pass != BLEND_PASS_ALL && (p_pass == BLEND_PASS_SAMPLED) != _is_sampled_track(ttype, track)) {
+				continue;
+			}
 			track->root_motion = root_motion_track == a->track_get_path(i);
 			switch (ttype) {
 				case Animation::TYPE_POSITION_3D: {
@@ -1162,12 +1499,12 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 					}
 					{
 						Vector3 loc;
-						Error err = a->try_position_track_interpolate(i, time, &loc);
+						Error err = _sample_track(&Animation::try_position_track_interpolate, a, i, time, &bindings[i].cursor, &loc);
 						if (err != OK) {
 							continue;
 						}
 						loc = post_process_key_value(a, i, loc, t->object_id, t->bone_idx);
-						t->loc += (loc - t->init_loc) * blend;
+						position_samples.push_back(t->transform_idx, loc, blend);
 					}
 #endif // _3D_DISABLED
 				} break;
@@ -1249,12 +1586,12 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 					}
 					{
 						Quaternion rot;
-						Error err = a->try_rotation_track_interpolate(i, time, &rot);
+						Error err = _sample_track(&Animation::try_rotation_track_interpolate, a, i, time, &bindings[i].cursor, &rot);
 						if (err != OK) {
 							continue;
 						}
 						rot = post_process_key_value(a, i, rot, t->object_id, t->bone_idx);
-						t->rot = (t->rot * Quaternion().slerp(t->init_rot.inverse() * rot, blend)).normalized();
+						rotation_samples.push_back(t->transform_idx, rot, blend);
 					}
 #endif // _3D_DISABLED
 				} break;
@@ -1337,12 +1674,12 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 					}
 					{
 						Vector3 scale;
-						Error err = a->try_scale_track_interpolate(i, time, &scale);
+						Error err = _sample_track(&Animation::try_scale_track_interpolate, a, i, time, &bindings[i].cursor, &scale);
 						if (err != OK) {
 							continue;
 						}
 						scale = post_process_key_value(a, i, scale, t->object_id, t->bone_idx);
-						t->scale += (scale - t->init_scale) * blend;
+						scale_samples.push_back(t->transform_idx, scale, blend);
 					}
 #endif // _3D_DISABLED
 				} break;
@@ -1353,7 +1690,7 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 					}
 					TrackCacheBlendShape *t = static_cast<TrackCacheBlendShape *>(track);
 					float value;
-					Error err = a->try_blend_shape_track_interpolate(i, time, &value);
+					Error err = _sample_track(&Animation::try_blend_shape_track_interpolate, a, i, time, &bindings[i].cursor, &value);
 					//ERR_CONTINUE(err!=OK); //used for testing, should be removed
 					if (err != OK) {
 						continue;
@@ -1611,6 +1948,10 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 				} break;
 			}
 		}
+		_blend_transform_samples();
+	}
+	if (p_pass != BLEND_PASS_TRIGGERED) {
+		_copy_transform_buffers_to_caches();
 	}
 }
 
@@ -1621,6 +1962,9 @@ void AnimationMixer::_blend_apply() {
 		if (!deterministic && Math::is_zero_approx(track->total_weight)) {
 			continue;
 		}
+		if (_is_track_culled(track->type)) {
+			continue;
+		}
 		switch (track->type) {
 			case Animation::TYPE_POSITION_3D: {
 #ifndef _3D_DISABLED
@@ -1983,6 +2327,8 @@ void AnimationMixer::restore(const Ref<AnimatedValuesBackup> &p_backup) {
 	track_cache = p_backup->get_data();
 	_blend_apply();
 	track_cache = HashMap<Animation::TypeHash, AnimationMixer::TrackCache *>();
+	track_bindings.clear();
+	_build_transform_buffers();
 	cache_valid = false;
 }
 
@@ -2031,17 +2377,34 @@ void AnimationMixer::_notification(int p_what) {
 
 		case NOTIFICATION_INTERNAL_PROCESS: {
 			if (active && callback_mode_process == ANIMATION_CALLBACK_MODE_PROCESS_IDLE) {
-				_process_animation(get_process_delta_time());
+				double delta = get_process_delta_time();
+				if (!_lod_consume_delta(delta)) {
+					break;
+				}
+				if (_can_blend_threaded()) {
+					_queue_threaded_blend(delta);
+				} else {
+					_process_animation(delta);
+				}
 			}
 		} break;
 
 		case NOTIFICATION_INTERNAL_PHYSICS_PROCESS: {
 			if (active && callback_mode_process == ANIMATION_CALLBACK_MODE_PROCESS_PHYSICS) {
-				_process_animation(get_physics_process_delta_time());
+				double delta = get_physics_process_delta_time();
+				if (!_lod_consume_delta(delta)) {
+					break;
+				}
+				if (_can_blend_threaded()) {
+					_queue_threaded_blend(delta);
+				} else {
+					_process_animation(delta);
+				}
 			}
 		} break;
 
 		case NOTIFICATION_EXIT_TREE: {
+			_cancel_threaded_blend();
 			_clear_caches();
 		} break;
 	}
@@ -2087,6 +2450,18 @@ void AnimationMixer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_deterministic", "deterministic"), &AnimationMixer::set_deterministic);
 	ClassDB::bind_method(D_METHOD("is_deterministic"), &AnimationMixer::is_deterministic);
 
+	ClassDB::bind_method(D_METHOD("set_threaded_blending_enabled", "enabled"), &AnimationMixer::set_threaded_blending_enabled);
+	ClassDB::bind_method(D_METHOD("is_threaded_blending_enabled"), &AnimationMixer::is_threaded_blending_enabled);
+
+	ClassDB::bind_method(D_METHOD("set_shared_sampling_enabled", "enabled"), &AnimationMixer::set_shared_sampling_enabled);
+	ClassDB::bind_method(D_METHOD("is_shared_sampling_enabled"), &AnimationMixer::is_shared_sampling_enabled);
+
+	ClassDB::bind_method(D_METHOD("set_lod_level", "level"), &AnimationMixer::set_lod_level);
+	ClassDB::bind_method(D_METHOD("get_lod_level"), &AnimationMixer::get_lod_level);
+
+	ClassDB::bind_method(D_METHOD("set_lod_use_camera_distance", "enabled"), &AnimationMixer::set_lod_use_camera_distance);
+	ClassDB::bind_method(D_METHOD("is_lod_using_camera_distance"), &AnimationMixer::is_lod_using_camera_distance);
+
 	ClassDB::bind_method(D_METHOD("set_root_node", "path"), &AnimationMixer::set_root_node);
 	ClassDB::bind_method(D_METHOD("get_root_node"), &AnimationMixer::get_root_node);
 
@@ -2117,6 +2492,8 @@ void AnimationMixer::_bind_methods() {
 
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "active"), "set_active", "is_active");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "deterministic"), "set_deterministic", "is_deterministic");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "threaded_blending"), "set_threaded_blending_enabled", "is_threaded_blending_enabled");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "shared_sampling"), "set_shared_sampling_enabled", "is_shared_sampling_enabled");
 
 	ClassDB::bind_method(D_METHOD("set_reset_on_save_enabled", "enabled"), &AnimationMixer::set_reset_on_save_enabled);
 	ClassDB::bind_method(D_METHOD("is_reset_on_save_enabled"), &AnimationMixer::is_reset_on_save_enabled);
@@ -2131,6 +2508,10 @@ void AnimationMixer::_bind_methods() {
 	ADD_GROUP("Audio", "audio_");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "audio_max_polyphony", PROPERTY_HINT_RANGE, "1,127,1"), "set_audio_max_polyphony", "get_audio_max_polyphony");
 
+	ADD_GROUP("LOD", "lod_");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "lod_level", PROPERTY_HINT_ENUM, "Full,Reduced,Minimal"), "set_lod_level", "get_lod_level");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "lod_use_camera_distance"), "set_lod_use_camera_distance", "is_lod_using_camera_distance");
+
 	ADD_GROUP("Callback Mode", "callback_mode_");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "callback_mode_process", PROPERTY_HINT_ENUM, "Physics,Idle,Manual"), "set_callback_mode_process", "get_callback_mode_process");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "callback_mode_method", PROPERTY_HINT_ENUM, "Deferred,Immediate"), "set_callback_mode_method", "get_callback_mode_method");
@@ -2142,6 +2523,11 @@ void AnimationMixer::_bind_methods() {
 	BIND_ENUM_CONSTANT(ANIMATION_CALLBACK_MODE_METHOD_DEFERRED);
 	BIND_ENUM_CONSTANT(ANIMATION_CALLBACK_MODE_METHOD_IMMEDIATE);
 
+	BIND_ENUM_CONSTANT(LOD_LEVEL_FULL);
+	BIND_ENUM_CONSTANT(LOD_LEVEL_REDUCED);
+	BIND_ENUM_CONSTANT(LOD_LEVEL_MINIMAL);
+	BIND_ENUM_CONSTANT(LOD_LEVEL_MAX);
+
 	ADD_SIGNAL(MethodInfo(SNAME("animation_list_changed")));
 	ADD_SIGNAL(MethodInfo(SNAME("animation_libraries_updated")));
 	ADD_SIGNAL(MethodInfo(SNAME("animation_finished"), PropertyInfo(Variant::STRING_NAME, "anim_name")));
@@ -2150,10 +2536,25 @@ void AnimationMixer::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("_reset"), &AnimationMixer::reset);
 	ClassDB::bind_method(D_METHOD("_restore", "backup"), &AnimationMixer::restore);
+
+	GLOBAL_DEF(PropertyInfo(Variant::INT, "animation/lod/reduced/update_rate", PROPERTY_HINT_RANGE, "0,240,1,suffix:FPS"), 30);
+	GLOBAL_DEF(PropertyInfo(Variant::INT, "animation/lod/reduced/culled_tracks", PROPERTY_HINT_FLAGS, "Blend Shape,Audio,Method"), 0);
+	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "animation/lod/reduced/camera_distance", PROPERTY_HINT_RANGE, "0,1000,0.1,or_greater,suffix:m"), 20.0);
+	GLOBAL_DEF(PropertyInfo(Variant::INT, "animation/lod/minimal/update_rate", PROPERTY_HINT_RANGE, "0,240,1,suffix:FPS"), 10);
+	GLOBAL_DEF(PropertyInfo(Variant::INT, "animation/lod/minimal/culled_tracks", PROPERTY_HINT_FLAGS, "Blend Shape,Audio,Method"), LOD_CULL_BLEND_SHAPE | LOD_CULL_AUDIO);
+	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "animation/lod/minimal/camera_distance", PROPERTY_HINT_RANGE, "0,1000,0.1,or_greater,suffix:m"), 50.0);
 }
 
 AnimationMixer::AnimationMixer() {
 	root_node = SceneStringNames::get_singleton()->path_pp;
+
+	const char *lod_names[LOD_LEVEL_MAX] = { nullptr, "reduced", "minimal" };
+	for (int i = LOD_LEVEL_FULL + 1; i < LOD_LEVEL_MAX; i++) {
+		const int update_rate = GLOBAL_GET(vformat("animation/lod/%s/update_rate", lod_names[i]));
+		lod_update_interval[i] = update_rate > 0 ? 1.0 / update_rate : 0.0;
+		lod_culled_tracks[i] = GLOBAL_GET(vformat("animation/lod/%s/culled_tracks", lod_names[i]));
+		lod_distance[i] = GLOBAL_GET(vformat("animation/lod/%s/camera_distance", lod_names[i]));
+	}
 }
 
 AnimationMixer::~AnimationMixer() {
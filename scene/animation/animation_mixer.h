@@ -41,6 +41,7 @@ class AnimatedValuesBackup;
 class AnimationMixer : public Node {
 	GDCLASS(AnimationMixer, Node);
 	friend AnimatedValuesBackup;
+	friend class SceneTree;
 #ifdef TOOLS_ENABLED
 	bool editing = false;
 	bool dummy = false;
@@ -60,6 +61,13 @@ public:
 		ANIMATION_CALLBACK_MODE_METHOD_IMMEDIATE,
 	};
 
+	enum LODLevel {
+		LOD_LEVEL_FULL,
+		LOD_LEVEL_REDUCED,
+		LOD_LEVEL_MINIMAL,
+		LOD_LEVEL_MAX,
+	};
+
 	/* ---- Data ---- */
 	struct AnimationLibraryData {
 		StringName name;
@@ -165,6 +173,7 @@ protected:
 		Vector3 loc;
 		Quaternion rot;
 		Vector3 scale;
+		int transform_idx = -1; // Index in the transform blend buffers.
 
 		TrackCacheTransform(const TrackCacheTransform &p_other) :
 				TrackCache(p_other),
@@ -180,7 +189,8 @@ protected:
 				init_scale(p_other.init_scale),
 				loc(p_other.loc),
 				rot(p_other.rot),
-				scale(p_other.scale) {
+				scale(p_other.scale),
+				transform_idx(p_other.transform_idx) {
 		}
 
 		TrackCacheTransform() {
@@ -300,7 +310,71 @@ protected:
 	LocalVector<AnimationInstance> animation_instances;
 	HashMap<NodePath, int> track_map;
 	int track_count = 0;
+
+	// What each track of an animation blends into, so the caches are looked up once per animation.
+	struct TrackBinding {
+		TrackCache *track = nullptr; // Null if the track isn't cached, e.g. its path wasn't found.
+		int blend_idx = -1;
+		int cursor = -1; // Last key sampled, see Animation::try_position_track_interpolate().
+	};
+	HashMap<ObjectID, LocalVector<TrackBinding>> track_bindings;
+	LocalVector<uint64_t> blend_idx_passes; // For each blend index, the last weight pass that counted it.
+	uint64_t weight_pass = 0;
+
+	// Transform tracks are blended in contiguous buffers indexed by TrackCacheTransform::transform_idx,
+	// and the results are copied to the caches once all animations are blended.
+	struct TransformBlendBuffers {
+		LocalVector<TrackCacheTransform *> tracks;
+		LocalVector<Vector3> init_loc;
+		LocalVector<Quaternion> init_rot_inv;
+		LocalVector<Vector3> init_scale;
+		LocalVector<Vector3> loc;
+		LocalVector<Quaternion> rot;
+		LocalVector<Vector3> scale;
+	};
+	TransformBlendBuffers transform_buffers;
+
+	// Transform samples of one animation, blended into the buffers in one batch per component.
+	template <class T>
+	struct TransformSampleBatch {
+		LocalVector<uint32_t> indices;
+		LocalVector<T> values;
+		LocalVector<real_t> weights;
+
+		_FORCE_INLINE_ void push_back(uint32_t p_index, const T &p_value, real_t p_weight) {
+			indices.push_back(p_index);
+			values.push_back(p_value);
+			weights.push_back(p_weight);
+		}
+		// Keeps the memory, so batching doesn't allocate every frame.
+		_FORCE_INLINE_ void clear() {
+			indices.clear();
+			values.clear();
+			weights.clear();
+		}
+	};
+	TransformSampleBatch<Vector3> position_samples;
+	TransformSampleBatch<Quaternion> rotation_samples;
+	TransformSampleBatch<Vector3> scale_samples;
 	bool deterministic = false;
+	bool threaded_blending = false;
+	bool shared_sampling = false;
+	bool threaded_blend_queued = false;
+	double threaded_blend_delta = 0.0;
+
+	/* ---- Level of detail ---- */
+	enum {
+		LOD_CULL_BLEND_SHAPE = 1,
+		LOD_CULL_AUDIO = 2,
+		LOD_CULL_METHOD = 4,
+	};
+	LODLevel lod_level = LOD_LEVEL_FULL;
+	bool lod_use_camera_distance = false;
+	double lod_accumulated_delta = 0.0;
+	// Read from the project settings, indexed by level.
+	double lod_update_interval[LOD_LEVEL_MAX] = {};
+	uint32_t lod_culled_tracks[LOD_LEVEL_MAX] = {};
+	real_t lod_distance[LOD_LEVEL_MAX] = {};
 
 	/* ---- Root motion accumulator for Skeleton3D ---- */
 	NodePath root_motion_track;
@@ -327,6 +401,14 @@ protected:
 	virtual void _rename_animation(const StringName &p_from_name, const StringName &p_to_name);
 
 	/* ---- Blending processor ---- */
+	// Which tracks _blend_process() handles. Sampled tracks only write to the track cache,
+	// so they can be blended away from the main thread; the rest have side effects.
+	enum BlendPass {
+		BLEND_PASS_ALL,
+		BLEND_PASS_SAMPLED,
+		BLEND_PASS_TRIGGERED,
+	};
+
 	virtual void _process_animation(double p_delta, bool p_update_only = false);
 	virtual Variant _post_process_key_value(const Ref<Animation> &p_anim, int p_track, Variant p_value, ObjectID p_object_id, int p_object_sub_idx = -1);
 	Variant post_process_key_value(const Ref<Animation> &p_anim, int p_track, Variant p_value, ObjectID p_object_id, int p_object_sub_idx = -1);
@@ -335,9 +417,27 @@ protected:
 	void _blend_init();
 	virtual bool _blend_pre_process(double p_delta, int p_track_count, const HashMap<NodePath, int> &p_track_map);
 	void _blend_calc_total_weight(); // For undeterministic blending.
-	void _blend_process(double p_delta, bool p_update_only = false);
+	void _blend_process(double p_delta, bool p_update_only = false, BlendPass p_pass = BLEND_PASS_ALL);
 	void _blend_apply();
 	virtual void _blend_post_process();
+
+	LocalVector<TrackBinding> &_get_track_bindings(const Ref<Animation> &p_animation);
+	void _build_transform_buffers();
+	void _blend_transform_samples();
+	void _copy_transform_buffers_to_caches();
+	static void _blend_vector3_samples(const TransformSampleBatch<Vector3> &p_samples, const Vector3 *p_init, Vector3 *r_values);
+	static void _blend_rotation_samples(const TransformSampleBatch<Quaternion> &p_samples, const Quaternion *p_init_inv, Quaternion *r_values);
+	template <class T>
+	Error _sample_track(Error (Animation::*p_sample)(int, double, T *, int *) const, const Ref<Animation> &p_animation, int p_track, double p_time, int *r_cursor, T *r_value);
+	static bool _is_sampled_track(Animation::TrackType p_type, const TrackCache *p_track);
+	bool _can_blend_threaded();
+	void _queue_threaded_blend(double p_delta);
+	void _blend_threaded();
+	void _apply_threaded_blend();
+	void _cancel_threaded_blend();
+	void _update_lod_level_from_camera();
+	bool _lod_consume_delta(double &r_delta);
+	bool _is_track_culled(Animation::TrackType p_type) const;
 	void _call_object(ObjectID p_object_id, const StringName &p_method, const Vector<Variant> &p_params, bool p_deferred);
 
 #ifndef DISABLE_DEPRECATED
@@ -370,6 +470,18 @@ public:
 	void set_deterministic(bool p_deterministic);
 	bool is_deterministic() const;
 
+	void set_threaded_blending_enabled(bool p_enabled);
+	bool is_threaded_blending_enabled() const;
+
+	void set_shared_sampling_enabled(bool p_enabled);
+	bool is_shared_sampling_enabled() const;
+
+	void set_lod_level(LODLevel p_level);
+	LODLevel get_lod_level() const;
+
+	void set_lod_use_camera_distance(bool p_enabled);
+	bool is_lod_using_camera_distance() const;
+
 	void set_root_node(const NodePath &p_path);
 	NodePath get_root_node() const;
 
@@ -440,5 +552,6 @@ public:
 
 VARIANT_ENUM_CAST(AnimationMixer::AnimationCallbackModeProcess);
 VARIANT_ENUM_CAST(AnimationMixer::AnimationCallbackModeMethod);
+VARIANT_ENUM_CAST(AnimationMixer::LODLevel);
 
 #endif // ANIMATION_MIXER_H
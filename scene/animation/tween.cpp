@@ -551,6 +551,12 @@ void PropertyTweener::start() {
 		return;
 	}
 
+	// Setting a plain property through its bound setter skips looking it up on every step.
+	setter = property.size() == 1 ? ClassDB::get_native_property_setget(target_instance->get_class_name(), property[0]) : nullptr;
+	if (setter && setter->setter == StringName()) {
+		setter = nullptr;
+	}
+
 	if (do_continue) {
 		if (Math::is_zero_approx(delay)) {
 			initial_val = target_instance->get_indexed(property);
@@ -589,11 +595,11 @@ bool PropertyTweener::step(double &r_delta) {
 
 	double time = MIN(elapsed_time - delay, duration);
 	if (time < duration) {
-		target_instance->set_indexed(property, tween->interpolate_variant(initial_val, delta_val, time, duration, trans_type, ease_type));
+		_set_target_value(target_instance, tween->interpolate_variant(initial_val, delta_val, time, duration, trans_type, ease_type));
 		r_delta = 0;
 		return true;
 	} else {
-		target_instance->set_indexed(property, final_val);
+		_set_target_value(target_instance, final_val);
 		finished = true;
 		r_delta = elapsed_time - delay - duration;
 		emit_signal(SNAME("finished"));
@@ -601,6 +607,15 @@ bool PropertyTweener::step(double &r_delta) {
 	}
 }
 
+void PropertyTweener::_set_target_value(Object *p_target, const Variant &p_value) {
+	// Scripts can handle any property themselves, so they always go through Object::set().
+	if (setter && !p_target->get_script_instance()) {
+		ClassDB::call_property_setter(p_target, *setter, p_value);
+	} else {
+		p_target->set_indexed(property, p_value);
+	}
+}
+
 void PropertyTweener::set_tween(const Ref<Tween> &p_tween) {
 	tween = p_tween;
 	if (trans_type == Tween::TRANS_MAX) {
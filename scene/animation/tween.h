@@ -31,6 +31,7 @@
 #ifndef TWEEN_H
 #define TWEEN_H
 
+#include "core/object/class_db.h"
 #include "core/object/ref_counted.h"
 
 class Tween;
@@ -212,6 +213,7 @@ protected:
 private:
 	ObjectID target;
 	Vector<StringName> property;
+	const ClassDB::PropertySetGet *setter = nullptr; // Native setter of the property, resolved on start.
 	Variant initial_val;
 	Variant base_final_val;
 	Variant final_val;
@@ -227,6 +229,8 @@ private:
 	bool do_continue = true;
 	bool do_continue_delayed = false;
 	bool relative = false;
+
+	void _set_target_value(Object *p_target, const Variant &p_value);
 };
 
 class IntervalTweener : public Tweener {
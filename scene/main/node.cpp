@@ -960,6 +960,16 @@ int Node::get_process_thread_group_order() const {
 	return data.process_thread_group_order;
 }
 
+void Node::set_process_thread_group_chunk_size(int p_size) {
+	ERR_THREAD_GUARD
+	ERR_FAIL_COND(p_size < 0);
+	data.process_thread_group_chunk_size = p_size;
+}
+
+int Node::get_process_thread_group_chunk_size() const {
+	return data.process_thread_group_chunk_size;
+}
+
 void Node::set_process_priority(int p_priority) {
 	ERR_THREAD_GUARD
 	if (data.process_priority == p_priority) {
@@ -3228,6 +3238,9 @@ void Node::_validate_property(PropertyInfo &p_property) const {
 	if ((p_property.name == "process_thread_group_order" || p_property.name == "process_thread_messages") && data.process_thread_group == PROCESS_THREAD_GROUP_INHERIT) {
 		p_property.usage = 0;
 	}
+	if (p_property.name == "process_thread_group_chunk_size" && data.process_thread_group != PROCESS_THREAD_GROUP_SUB_THREAD) {
+		p_property.usage = 0;
+	}
 }
 
 void Node::input(const Ref<InputEvent> &p_event) {
@@ -3406,6 +3419,8 @@ void Node::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("set_process_thread_group_order", "order"), &Node::set_process_thread_group_order);
 	ClassDB::bind_method(D_METHOD("get_process_thread_group_order"), &Node::get_process_thread_group_order);
+	ClassDB::bind_method(D_METHOD("set_process_thread_group_chunk_size", "size"), &Node::set_process_thread_group_chunk_size);
+	ClassDB::bind_method(D_METHOD("get_process_thread_group_chunk_size"), &Node::get_process_thread_group_chunk_size);
 
 	ClassDB::bind_method(D_METHOD("set_display_folded", "fold"), &Node::set_display_folded);
 	ClassDB::bind_method(D_METHOD("is_displayed_folded"), &Node::is_displayed_folded);
@@ -3589,6 +3604,7 @@ void Node::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_thread_group", PROPERTY_HINT_ENUM, "Inherit,Main Thread,Sub Thread"), "set_process_thread_group", "get_process_thread_group");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_thread_group_order"), "set_process_thread_group_order", "get_process_thread_group_order");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_thread_messages", PROPERTY_HINT_FLAGS, "Process,Physics Process"), "set_process_thread_messages", "get_process_thread_messages");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_thread_group_chunk_size", PROPERTY_HINT_RANGE, "0,1024,1,or_greater"), "set_process_thread_group_chunk_size", "get_process_thread_group_chunk_size");
 
 	ADD_GROUP("Editor Description", "editor_");
 	ADD_PROPERTY(PropertyInfo(Variant::STRING, "editor_description", PROPERTY_HINT_MULTILINE_TEXT), "set_editor_description", "get_editor_description");
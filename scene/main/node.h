@@ -183,6 +183,7 @@ private:
 		ProcessThreadGroup process_thread_group = PROCESS_THREAD_GROUP_INHERIT;
 		Node *process_thread_group_owner = nullptr;
 		int process_thread_group_order = 0;
+		int process_thread_group_chunk_size = 0;
 		BitField<ProcessThreadMessages> process_thread_messages;
 		void *process_group = nullptr; // to avoid cyclic dependency
 
@@ -525,6 +526,9 @@ public:
 	void set_process_thread_group_order(int p_order);
 	int get_process_thread_group_order() const;
 
+	void set_process_thread_group_chunk_size(int p_size);
+	int get_process_thread_group_chunk_size() const;
+
 	void set_physics_process_priority(int p_priority);
 	int get_physics_process_priority() const;
 
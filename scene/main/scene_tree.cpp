@@ -31,6 +31,7 @@
 #include "scene_tree.h"
 
 #include "core/config/project_settings.h"
+#include "core/core_string_names.h"
 #include "core/debugger/engine_debugger.h"
 #include "core/input/input.h"
 #include "core/io/dir_access.h"
@@ -43,6 +44,7 @@
 #include "core/os/os.h"
 #include "core/string/print_string.h"
 #include "node.h"
+#include "scene/animation/animation_mixer.h"
 #include "scene/animation/tween.h"
 #include "scene/debugger/scene_debugger.h"
 #include "scene/gui/control.h"
@@ -149,11 +151,12 @@ SceneTree::Group *SceneTree::add_to_group(const StringName &p_group, Node *p_nod
 		E = group_map.insert(p_group, Group());
 	}
 
-	ERR_FAIL_COND_V_MSG(E->value.nodes.has(p_node), &E->value, "Already in group: " + p_group + ".");
-	E->value.nodes.push_back(p_node);
-	//E->value.last_tree_version=0;
-	E->value.changed = true;
-	return &E->value;
+	Group &g = E->value;
+	ERR_FAIL_COND_V_MSG(g.node_indices.has(p_node), &g, "Already in group: " + p_group + ".");
+	// Appended after the sorted range, it will be merged in when the order is needed.
+	g.node_indices.insert(p_node, g.nodes.size());
+	g.nodes.push_back(p_node);
+	return &g;
 }
 
 void SceneTree::remove_from_group(const StringName &p_group, Node *p_node) {
@@ -162,9 +165,24 @@ void SceneTree::remove_from_group(const StringName &p_group, Node *p_node) {
 	HashMap<StringName, Group>::Iterator E = group_map.find(p_group);
 	ERR_FAIL_COND(!E);
 
-	E->value.nodes.erase(p_node);
-	if (E->value.nodes.is_empty()) {
+	Group &g = E->value;
+	HashMap<Node *, uint32_t>::Iterator I = g.node_indices.find(p_node);
+	ERR_FAIL_COND(!I);
+
+	if (g.node_indices.size() == 1) {
 		group_map.remove(E);
+		return;
+	}
+
+	uint32_t index = I->value;
+	g.node_indices.remove(I);
+	if (index == uint32_t(g.nodes.size() - 1)) {
+		g.nodes.resize(index);
+		g.sorted_count = MIN(g.sorted_count, index);
+	} else {
+		// Leave a hole instead of shifting the remaining members and their indices.
+		g.nodes.write[index] = nullptr;
+		g.removed_count++;
 	}
 }
 
@@ -210,22 +228,118 @@ void SceneTree::_flush_ugc() {
 }
 
 void SceneTree::_update_group_order(Group &g) {
-	if (!g.changed) {
-		return;
-	}
-	if (g.nodes.is_empty()) {
+	int gr_node_count = g.nodes.size();
+	if (!g.changed && g.removed_count == 0 && g.sorted_count == uint32_t(gr_node_count)) {
 		return;
 	}
 
 	Node **gr_nodes = g.nodes.ptrw();
-	int gr_node_count = g.nodes.size();
+	int first_moved = gr_node_count;
+
+	if (g.removed_count > 0) {
+		// Compact the holes left by removed nodes, keeping the relative order.
+		uint32_t sorted_count = 0;
+		int to = 0;
+		for (int from = 0; from < gr_node_count; from++) {
+			if (!gr_nodes[from]) {
+				first_moved = MIN(first_moved, to);
+				continue;
+			}
+			if (uint32_t(from) < g.sorted_count) {
+				sorted_count++;
+			}
+			gr_nodes[to++] = gr_nodes[from];
+		}
+		gr_node_count = to;
+		g.nodes.resize(gr_node_count);
+		gr_nodes = g.nodes.ptrw();
+		g.sorted_count = sorted_count;
+		g.removed_count = 0;
+	}
 
 	SortArray<Node *, Node::Comparator> node_sort;
-	node_sort.sort(gr_nodes, gr_node_count);
+	if (g.changed || g.sorted_count == 0) {
+		node_sort.sort(gr_nodes, gr_node_count);
+		first_moved = 0;
+	} else if (g.sorted_count < uint32_t(gr_node_count)) {
+		// Only the nodes added since the last update are out of place, sort them and merge them in.
+		int sorted_count = g.sorted_count;
+		node_sort.sort(&gr_nodes[sorted_count], gr_node_count - sorted_count);
+
+		Node::Comparator compare;
+		// Sorted nodes before the first new one in tree order don't need to move.
+		int merge_from = 0;
+		int merge_to = sorted_count;
+		while (merge_from < merge_to) {
+			int middle = (merge_from + merge_to) / 2;
+			if (compare(gr_nodes[sorted_count], gr_nodes[middle])) {
+				merge_to = middle;
+			} else {
+				merge_from = middle + 1;
+			}
+		}
+
+		if (merge_from < sorted_count) {
+			LocalVector<Node *> head;
+			head.resize(sorted_count - merge_from);
+			memcpy(head.ptr(), &gr_nodes[merge_from], head.size() * sizeof(Node *));
+
+			uint32_t a = 0;
+			int b = sorted_count;
+			int to = merge_from;
+			while (a < head.size() && b < gr_node_count) {
+				if (compare(gr_nodes[b], head[a])) {
+					gr_nodes[to++] = gr_nodes[b++];
+				} else {
+					gr_nodes[to++] = head[a++];
+				}
+			}
+			while (a < head.size()) {
+				gr_nodes[to++] = head[a++];
+			}
+			first_moved = MIN(first_moved, merge_from);
+		} else {
+			first_moved = MIN(first_moved, sorted_count);
+		}
+	}
 
+	for (int i = first_moved; i < gr_node_count; i++) {
+		g.node_indices[gr_nodes[i]] = i;
+	}
+
+	g.sorted_count = gr_node_count;
 	g.changed = false;
 }
 
+// Members of a group are usually of the same few classes, so the method is looked up
+// again only when the class changes between consecutive nodes without a script.
+struct GroupCallCache {
+	StringName class_name;
+	MethodBind *method = nullptr;
+	bool disabled = false;
+};
+
+static _FORCE_INLINE_ void _call_group_node(Node *p_node, const StringName &p_function, const Variant **p_args, int p_argcount, GroupCallCache &r_cache) {
+	Callable::CallError ce;
+	if (r_cache.disabled || p_node->get_script_instance()) {
+		p_node->callp(p_function, p_args, p_argcount, ce);
+		return;
+	}
+
+	const StringName &class_name = p_node->get_class_name();
+	if (class_name != r_cache.class_name) {
+		r_cache.class_name = class_name;
+		r_cache.method = ClassDB::get_method(class_name, p_function);
+	}
+
+	if (r_cache.method) {
+#ifdef DEBUG_ENABLED
+		_ObjectDebugLock debug_lock(p_node);
+#endif
+		r_cache.method->call(p_node, p_args, p_argcount, ce);
+	}
+}
+
 void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_group, const StringName &p_function, const Variant **p_args, int p_argcount) {
 	Vector<Node *> nodes_copy;
 
@@ -273,6 +387,11 @@ void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_gro
 		nodes_removed_on_group_call_lock++;
 	}
 
+	GroupCallCache cache;
+	if (p_function == CoreStringNames::get_singleton()->_free) {
+		cache.disabled = true;
+	}
+
 	if (p_call_flags & GROUP_CALL_REVERSE) {
 		for (int i = gr_node_count - 1; i >= 0; i--) {
 			if (nodes_removed_on_group_call_lock && nodes_removed_on_group_call.has(gr_nodes[i])) {
@@ -280,8 +399,7 @@ void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_gro
 			}
 
 			if (!(p_call_flags & GROUP_CALL_DEFERRED)) {
-				Callable::CallError ce;
-				gr_nodes[i]->callp(p_function, p_args, p_argcount, ce);
+				_call_group_node(gr_nodes[i], p_function, p_args, p_argcount, cache);
 			} else {
 				MessageQueue::get_singleton()->push_callp(gr_nodes[i], p_function, p_args, p_argcount);
 			}
@@ -294,8 +412,7 @@ void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_gro
 			}
 
 			if (!(p_call_flags & GROUP_CALL_DEFERRED)) {
-				Callable::CallError ce;
-				gr_nodes[i]->callp(p_function, p_args, p_argcount, ce);
+				_call_group_node(gr_nodes[i], p_function, p_args, p_argcount, cache);
 			} else {
 				MessageQueue::get_singleton()->push_callp(gr_nodes[i], p_function, p_args, p_argcount);
 			}
@@ -466,6 +583,7 @@ bool SceneTree::physics_process(double p_time) {
 	call_group(SNAME("_picking_viewports"), SNAME("_process_picking"));
 
 	_process(true);
+	_flush_threaded_animation_mixers();
 
 	_flush_ugc();
 	MessageQueue::get_singleton()->flush(); //small little hack
@@ -506,6 +624,7 @@ bool SceneTree::process(double p_time) {
 	flush_transform_notifications();
 
 	_process(false);
+	_flush_threaded_animation_mixers();
 
 	_flush_ugc();
 	MessageQueue::get_singleton()->flush(); //small little hack
@@ -618,6 +737,8 @@ void SceneTree::process_tweens(double p_delta, bool p_physics) {
 }
 
 void SceneTree::finalize() {
+	pool_clear(Ref<PackedScene>());
+
 	_flush_delete_queue();
 
 	_flush_ugc();
@@ -895,16 +1016,8 @@ bool SceneTree::is_paused() const {
 	return paused;
 }
 
-void SceneTree::_process_group(ProcessGroup *p_group, bool p_physics) {
-	// When reading this function, keep in mind that this code must work in a way where
-	// if any node is removed, this needs to continue working.
-
-	p_group->call_queue.flush(); // Flush messages before processing.
-
+uint32_t SceneTree::_prepare_process_group_nodes(ProcessGroup *p_group, bool p_physics) {
 	Vector<Node *> &nodes = p_physics ? p_group->physics_nodes : p_group->nodes;
-	if (nodes.is_empty()) {
-		return;
-	}
 
 	if (p_physics) {
 		if (p_group->physics_node_order_dirty) {
@@ -919,12 +1032,14 @@ void SceneTree::_process_group(ProcessGroup *p_group, bool p_physics) {
 	}
 
 	// Make a copy, so if nodes are added/removed from process, this does not break
-	Vector<Node *> nodes_copy = nodes;
+	p_group->nodes_copy = nodes;
+	return p_group->nodes_copy.size();
+}
 
-	uint32_t node_count = nodes_copy.size();
-	Node **nodes_ptr = (Node **)nodes_copy.ptr(); // Force cast, pointer will not change.
+void SceneTree::_process_group_nodes(ProcessGroup *p_group, uint32_t p_from, uint32_t p_to, bool p_physics) {
+	Node **nodes_ptr = (Node **)p_group->nodes_copy.ptr(); // Force cast, pointer will not change.
 
-	for (uint32_t i = 0; i < node_count; i++) {
+	for (uint32_t i = p_from; i < p_to; i++) {
 		Node *n = nodes_ptr[i];
 		if (nodes_removed_on_group_call.has(n)) {
 			// Node may have been removed during process, skip it.
@@ -952,16 +1067,131 @@ void SceneTree::_process_group(ProcessGroup *p_group, bool p_physics) {
 			}
 		}
 	}
+}
+
+void SceneTree::_process_group(ProcessGroup *p_group, bool p_physics) {
+	// When reading this function, keep in mind that this code must work in a way where
+	// if any node is removed, this needs to continue working.
+
+#ifdef DEBUG_ENABLED
+	uint64_t begin_usec = process_groups_profiling ? OS::get_singleton()->get_ticks_usec() : 0;
+#endif
+
+	p_group->call_queue.flush(); // Flush messages before processing.
+
+	const Vector<Node *> &nodes = p_physics ? p_group->physics_nodes : p_group->nodes;
+	if (!nodes.is_empty()) {
+		uint32_t node_count = _prepare_process_group_nodes(p_group, p_physics);
+		_process_group_nodes(p_group, 0, node_count, p_physics);
+		p_group->nodes_copy.clear();
+
+		p_group->call_queue.flush(); // Flush messages also after processing (for potential deferred calls).
+	}
 
-	p_group->call_queue.flush(); // Flush messages also after processing (for potential deferred calls).
+#ifdef DEBUG_ENABLED
+	if (process_groups_profiling) {
+		p_group->profile_time_usec.add(OS::get_singleton()->get_ticks_usec() - begin_usec);
+	}
+#endif
 }
 
 void SceneTree::_process_groups_thread(uint32_t p_index, bool p_physics) {
-	Node::current_process_thread_group = local_process_group_cache[p_index]->owner;
-	_process_group(local_process_group_cache[p_index], p_physics);
+	const ProcessGroupTask &task = local_process_group_tasks[p_index];
+	Node::current_process_thread_group = task.group->owner;
+	if (task.whole_group) {
+		_process_group(task.group, p_physics);
+	} else {
+#ifdef DEBUG_ENABLED
+		uint64_t begin_usec = process_groups_profiling ? OS::get_singleton()->get_ticks_usec() : 0;
+#endif
+		_process_group_nodes(task.group, task.from, task.to, p_physics);
+#ifdef DEBUG_ENABLED
+		if (process_groups_profiling) {
+			task.group->profile_time_usec.add(OS::get_singleton()->get_ticks_usec() - begin_usec);
+		}
+#endif
+	}
 	Node::current_process_thread_group = nullptr;
 }
 
+void SceneTree::_process_groups_threaded(bool p_physics) {
+	local_process_group_tasks.clear();
+	local_process_group_split_cache.clear();
+
+	// Groups that must be processed as a whole are queued first. The worker threads pick tasks in order
+	// as they become idle, so the chunks of split groups then fill in around the heavier tasks.
+	for (ProcessGroup *pg : local_process_group_cache) {
+		if (pg->owner->data.process_thread_group_chunk_size > 0) {
+			local_process_group_split_cache.push_back(pg);
+			continue;
+		}
+		ProcessGroupTask task;
+		task.group = pg;
+		local_process_group_tasks.push_back(task);
+	}
+
+	for (ProcessGroup *pg : local_process_group_split_cache) {
+		// Messages can't be split, so they are flushed before and after all the chunks run.
+		Node::current_process_thread_group = pg->owner;
+		pg->call_queue.flush();
+		Node::current_process_thread_group = nullptr;
+
+		uint32_t node_count = _prepare_process_group_nodes(pg, p_physics);
+		uint32_t chunk_size = pg->owner->data.process_thread_group_chunk_size;
+		for (uint32_t from = 0; from < node_count; from += chunk_size) {
+			ProcessGroupTask task;
+			task.group = pg;
+			task.whole_group = false;
+			task.from = from;
+			task.to = MIN(from + chunk_size, node_count);
+			local_process_group_tasks.push_back(task);
+		}
+	}
+
+	if (!local_process_group_tasks.is_empty()) {
+		WorkerThreadPool::GroupID id = WorkerThreadPool::get_singleton()->add_template_group_task(this, &SceneTree::_process_groups_thread, p_physics, local_process_group_tasks.size(), -1, true);
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(id);
+	}
+
+	for (ProcessGroup *pg : local_process_group_split_cache) {
+		pg->nodes_copy.clear();
+
+		Node::current_process_thread_group = pg->owner;
+		pg->call_queue.flush(); // Flush messages also after processing (for potential deferred calls).
+		Node::current_process_thread_group = nullptr;
+	}
+}
+
+void SceneTree::_blend_animation_mixer_thread(uint32_t p_index, AnimationMixer **p_mixers) {
+	if (p_mixers[p_index]) {
+		p_mixers[p_index]->_blend_threaded();
+	}
+}
+
+void SceneTree::_flush_threaded_animation_mixers() {
+	if (threaded_animation_mixers.is_empty()) {
+		return;
+	}
+
+	WorkerThreadPool::GroupID id = WorkerThreadPool::get_singleton()->add_template_group_task(this, &SceneTree::_blend_animation_mixer_thread, threaded_animation_mixers.ptr(), threaded_animation_mixers.size(), -1, true, SNAME("AnimationMixers"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(id);
+
+	// Applying can run user code, which may remove mixers from the tree. Those leave a null behind.
+	for (uint32_t i = 0; i < threaded_animation_mixers.size(); i++) {
+		if (threaded_animation_mixers[i]) {
+			threaded_animation_mixers[i]->_apply_threaded_blend();
+		}
+	}
+	threaded_animation_mixers.clear();
+}
+
+void SceneTree::_remove_threaded_animation_mixer(AnimationMixer *p_mixer) {
+	int64_t idx = threaded_animation_mixers.find(p_mixer);
+	if (idx >= 0) {
+		threaded_animation_mixers[idx] = nullptr;
+	}
+}
+
 void SceneTree::_process(bool p_physics) {
 	if (process_groups_dirty) {
 		{
@@ -1001,6 +1231,9 @@ void SceneTree::_process(bool p_physics) {
 	}
 
 	process_last_pass++; // Increment pass
+#ifdef DEBUG_ENABLED
+	process_groups_profiling = EngineDebugger::is_profiling("servers");
+#endif
 	uint32_t from = 0;
 	uint32_t process_count = 0;
 	nodes_removed_on_group_call_lock++;
@@ -1031,8 +1264,7 @@ void SceneTree::_process(bool p_physics) {
 				}
 
 				if (using_threads) {
-					WorkerThreadPool::GroupID id = WorkerThreadPool::get_singleton()->add_template_group_task(this, &SceneTree::_process_groups_thread, p_physics, local_process_group_cache.size(), -1, true);
-					WorkerThreadPool::get_singleton()->wait_for_group_task_completion(id);
+					_process_groups_threaded(p_physics);
 				}
 			}
 
@@ -1078,6 +1310,25 @@ void SceneTree::_process(bool p_physics) {
 	if (nodes_removed_on_group_call_lock == 0) {
 		nodes_removed_on_group_call.clear();
 	}
+
+#ifdef DEBUG_ENABLED
+	if (process_groups_profiling) {
+		Array values;
+		for (uint32_t i = 0; i < group_count; i++) {
+			ProcessGroup *pg = process_groups[i];
+			if (pg->removed || pg->last_pass != process_last_pass) {
+				pg->profile_time_usec.set(0);
+				continue;
+			}
+			values.push_back(pg->owner ? String(pg->owner->get_path()) : String("default"));
+			values.push_back(USEC_TO_SEC(pg->profile_time_usec.get()));
+			pg->profile_time_usec.set(0);
+		}
+
+		values.push_front(p_physics ? "physics_process_groups" : "process_groups");
+		EngineDebugger::profiler_add_frame_data("servers", values);
+	}
+#endif
 }
 
 bool SceneTree::ProcessGroupSort::operator()(const ProcessGroup *p_left, const ProcessGroup *p_right) const {
@@ -1309,7 +1560,7 @@ int SceneTree::get_node_count_in_group(const StringName &p_group) const {
 		return 0;
 	}
 
-	return E->value.nodes.size();
+	return E->value.get_node_count();
 }
 
 Node *SceneTree::get_first_node_in_group(const StringName &p_group) {
@@ -1365,6 +1616,125 @@ void SceneTree::queue_delete(Object *p_object) {
 	delete_queue.push_back(p_object->get_instance_id());
 }
 
+void SceneTree::_prune_pooled_nodes() {
+	// Forget nodes that were freed instead of released, so the bookkeeping doesn't grow with churn.
+	LocalVector<ObjectID> freed;
+	for (const KeyValue<ObjectID, PooledNode> &E : pooled_nodes) {
+		if (!ObjectDB::get_instance(E.key)) {
+			freed.push_back(E.key);
+		}
+	}
+	for (const ObjectID &id : freed) {
+		pooled_nodes.erase(id);
+	}
+	pooled_nodes_prune_size = MAX(64u, pooled_nodes.size() * 2);
+}
+
+Node *SceneTree::pool_instantiate(const Ref<PackedScene> &p_scene) {
+	_THREAD_SAFE_METHOD_
+	ERR_FAIL_COND_V(p_scene.is_null(), nullptr);
+
+	LocalVector<ObjectID> *pool = node_pools.getptr(p_scene);
+	while (pool && !pool->is_empty()) {
+		ObjectID id = (*pool)[pool->size() - 1];
+		pool->remove_at(pool->size() - 1);
+
+		Node *node = Object::cast_to<Node>(ObjectDB::get_instance(id));
+		PooledNode *pooled = pooled_nodes.getptr(id);
+		if (node && pooled && pooled->available && !node->get_parent()) {
+			pooled->available = false;
+			return node;
+		}
+		// Freed or reparented while in the pool.
+		if (pooled) {
+			pooled->available = false;
+		}
+	}
+
+	Node *node = p_scene->instantiate();
+	ERR_FAIL_NULL_V(node, nullptr);
+
+	PooledNode pooled;
+	pooled.scene = p_scene;
+	pooled_nodes.insert(node->get_instance_id(), pooled);
+	if (pooled_nodes.size() >= pooled_nodes_prune_size) {
+		_prune_pooled_nodes();
+	}
+
+	return node;
+}
+
+void SceneTree::pool_release(Node *p_node) {
+	_THREAD_SAFE_METHOD_
+	ERR_FAIL_NULL(p_node);
+	ERR_FAIL_COND_MSG(p_node->is_queued_for_deletion(), "Can't release a node queued for deletion to the pool.");
+
+	ObjectID id = p_node->get_instance_id();
+	PooledNode *pooled = pooled_nodes.getptr(id);
+	ERR_FAIL_NULL_MSG(pooled, "Can't release a node to the pool that was not created with pool_instantiate().");
+	ERR_FAIL_COND_MSG(pooled->available, "Node was already released to the pool.");
+
+	Node *parent = p_node->get_parent();
+	if (parent) {
+		parent->remove_child(p_node);
+		ERR_FAIL_COND_MSG(p_node->get_parent(), "Failed to remove the node from its parent, try releasing it with call_deferred().");
+	}
+
+	pooled = pooled_nodes.getptr(id); // Exit tree callbacks may have touched the pool, so look it up again.
+	ERR_FAIL_NULL(pooled);
+	Ref<PackedScene> scene = pooled->scene;
+	if (scene->get_state()->reset_instance(p_node) != OK) {
+		// Changed beyond what can be reset, so it can't be reused.
+		pooled_nodes.erase(id);
+		p_node->queue_free();
+		return;
+	}
+	p_node->set_name(scene->get_state()->get_node_name(0));
+
+	pooled = pooled_nodes.getptr(id);
+	ERR_FAIL_NULL(pooled);
+	pooled->available = true;
+	node_pools[scene].push_back(id);
+}
+
+int SceneTree::pool_get_available_count(const Ref<PackedScene> &p_scene) const {
+	_THREAD_SAFE_METHOD_
+	const LocalVector<ObjectID> *pool = node_pools.getptr(p_scene);
+	return pool ? pool->size() : 0;
+}
+
+void SceneTree::pool_clear(const Ref<PackedScene> &p_scene) {
+	_THREAD_SAFE_METHOD_
+	LocalVector<ObjectID> ids;
+	if (p_scene.is_valid()) {
+		LocalVector<ObjectID> *pool = node_pools.getptr(p_scene);
+		if (pool) {
+			ids = *pool;
+		}
+		node_pools.erase(p_scene);
+	} else {
+		for (const KeyValue<Ref<PackedScene>, LocalVector<ObjectID>> &E : node_pools) {
+			for (const ObjectID &id : E.value) {
+				ids.push_back(id);
+			}
+		}
+		node_pools.clear();
+	}
+
+	for (const ObjectID &id : ids) {
+		PooledNode *pooled = pooled_nodes.getptr(id);
+		if (!pooled || !pooled->available) {
+			continue;
+		}
+		pooled_nodes.erase(id);
+
+		Node *node = Object::cast_to<Node>(ObjectDB::get_instance(id));
+		if (node && !node->get_parent()) {
+			memdelete(node);
+		}
+	}
+}
+
 int SceneTree::get_node_count() const {
 	return nodes_in_tree_count;
 }
@@ -1604,6 +1974,11 @@ void SceneTree::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("queue_delete", "obj"), &SceneTree::queue_delete);
 
+	ClassDB::bind_method(D_METHOD("pool_instantiate", "scene"), &SceneTree::pool_instantiate);
+	ClassDB::bind_method(D_METHOD("pool_release", "node"), &SceneTree::pool_release);
+	ClassDB::bind_method(D_METHOD("pool_get_available_count", "scene"), &SceneTree::pool_get_available_count);
+	ClassDB::bind_method(D_METHOD("pool_clear", "scene"), &SceneTree::pool_clear, DEFVAL(Ref<PackedScene>()));
+
 	MethodInfo mi;
 	mi.name = "call_group_flags";
 	mi.arguments.push_back(PropertyInfo(Variant::INT, "flags"));
@@ -1893,6 +2268,8 @@ SceneTree::SceneTree() {
 }
 
 SceneTree::~SceneTree() {
+	pool_clear(Ref<PackedScene>());
+
 	if (prev_scene) {
 		memdelete(prev_scene);
 		prev_scene = nullptr;
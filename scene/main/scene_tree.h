@@ -39,6 +39,7 @@
 
 #undef Window
 
+class AnimationMixer;
 class PackedScene;
 class Node;
 class Window;
@@ -98,6 +99,18 @@ private:
 		bool removed = false;
 		Node *owner = nullptr;
 		uint64_t last_pass = 0;
+		Vector<Node *> nodes_copy; // What is being processed, so nodes can be added or removed meanwhile.
+#ifdef DEBUG_ENABLED
+		SafeNumeric<uint64_t> profile_time_usec;
+#endif
+	};
+
+	// A whole group, or a chunk of the nodes of a group that allows to be split across threads.
+	struct ProcessGroupTask {
+		ProcessGroup *group = nullptr;
+		bool whole_group = true;
+		uint32_t from = 0;
+		uint32_t to = 0;
 	};
 
 	struct ProcessGroupSort {
@@ -109,15 +122,30 @@ private:
 	LocalVector<ProcessGroup *> process_groups;
 	bool process_groups_dirty = true;
 	LocalVector<ProcessGroup *> local_process_group_cache; // Used when processing to group what needs to
+	LocalVector<ProcessGroupTask> local_process_group_tasks;
+	LocalVector<ProcessGroup *> local_process_group_split_cache;
+#ifdef DEBUG_ENABLED
+	bool process_groups_profiling = false;
+#endif
 	uint64_t process_last_pass = 1;
 
 	ProcessGroup default_process_group;
 
 	bool node_threading_disabled = false;
 
+	// Mixers that blend on the WorkerThreadPool once all nodes have processed, then apply in order.
+	LocalVector<AnimationMixer *> threaded_animation_mixers;
+
 	struct Group {
+		// Removed nodes are left as null entries until _update_group_order() compacts the array,
+		// so only access `nodes` directly after updating the order.
 		Vector<Node *> nodes;
-		bool changed = false;
+		HashMap<Node *, uint32_t> node_indices; // Position of each member in `nodes`.
+		uint32_t removed_count = 0;
+		uint32_t sorted_count = 0; // Entries before this one are in tree order.
+		bool changed = false; // Tree order of the members changed, sort everything again.
+
+		_FORCE_INLINE_ int get_node_count() const { return nodes.size() - removed_count; }
 	};
 
 	Window *root = nullptr;
@@ -169,6 +197,16 @@ private:
 
 	List<ObjectID> delete_queue;
 
+	struct PooledNode {
+		Ref<PackedScene> scene;
+		bool available = false;
+	};
+
+	HashMap<Ref<PackedScene>, LocalVector<ObjectID>> node_pools; // Released instances, ready to be handed out again.
+	HashMap<ObjectID, PooledNode> pooled_nodes; // Every node created by pool_instantiate().
+	uint32_t pooled_nodes_prune_size = 64;
+	void _prune_pooled_nodes();
+
 	HashMap<UGCall, Vector<Variant>, UGCall> unique_group_calls;
 	bool ugc_locked = false;
 	void _flush_ugc();
@@ -215,10 +253,17 @@ private:
 	void remove_from_group(const StringName &p_group, Node *p_node);
 	void make_group_changed(const StringName &p_group);
 
+	uint32_t _prepare_process_group_nodes(ProcessGroup *p_group, bool p_physics);
+	void _process_group_nodes(ProcessGroup *p_group, uint32_t p_from, uint32_t p_to, bool p_physics);
 	void _process_group(ProcessGroup *p_group, bool p_physics);
 	void _process_groups_thread(uint32_t p_index, bool p_physics);
+	void _process_groups_threaded(bool p_physics);
 	void _process(bool p_physics);
 
+	void _blend_animation_mixer_thread(uint32_t p_index, AnimationMixer **p_mixers);
+	void _flush_threaded_animation_mixers();
+	void _remove_threaded_animation_mixer(AnimationMixer *p_mixer);
+
 	void _remove_process_group(Node *p_node);
 	void _add_process_group(Node *p_node);
 	void _remove_node_from_process_group(Node *p_node, Node *p_owner);
@@ -229,6 +274,7 @@ private:
 
 	void _flush_delete_queue();
 	// Optimization.
+	friend class AnimationMixer;
 	friend class CanvasItem;
 	friend class Node3D;
 	friend class Viewport;
@@ -382,6 +428,11 @@ public:
 
 	void queue_delete(Object *p_object);
 
+	Node *pool_instantiate(const Ref<PackedScene> &p_scene);
+	void pool_release(Node *p_node);
+	int pool_get_available_count(const Ref<PackedScene> &p_scene) const;
+	void pool_clear(const Ref<PackedScene> &p_scene);
+
 	void get_nodes_in_group(const StringName &p_group, List<Node *> *p_list);
 	Node *get_first_node_in_group(const StringName &p_group);
 	bool has_group(const StringName &p_identifier) const;
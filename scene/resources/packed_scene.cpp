@@ -35,6 +35,7 @@
 #include "core/core_string_names.h"
 #include "core/io/missing_resource.h"
 #include "core/io/resource_loader.h"
+#include "core/object/script_language.h"
 #include "core/templates/local_vector.h"
 #include "scene/2d/node_2d.h"
 #include "scene/3d/node_3d.h"
@@ -156,6 +157,10 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 
 	const NodeData *nd = &nodes[0];
 
+	const InstantiationPlan &plan = _get_instantiation_plan();
+	// Setting properties through their resolved setters skips Object::set(), which only matters for editing.
+	const bool use_plan_setters = p_edit_state == GEN_EDIT_STATE_DISABLED;
+
 	Node **ret_nodes = (Node **)alloca(sizeof(Node *) * nc);
 
 	bool gen_node_path_cache = p_edit_state != GEN_EDIT_STATE_DISABLED && node_path_cache.is_empty();
@@ -189,6 +194,8 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 
 		Node *node = nullptr;
 		MissingNode *missing_node = nullptr;
+		const InstantiationPlan::NodePlan &node_plan = plan.nodes[i];
+		bool created_from_plan = false;
 
 		if (i == 0 && base_scene_idx >= 0) {
 			//scene inheritance on root node
@@ -234,9 +241,10 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 			}
 		} else {
 			//node belongs to this scene and must be created
-			Object *obj = ClassDB::instantiate(snames[n.type]);
+			Object *obj = node_plan.creation_func ? node_plan.creation_func() : ClassDB::instantiate(snames[n.type]);
 
 			node = Object::cast_to<Node>(obj);
+			created_from_plan = node && node_plan.creation_func;
 
 			if (!node) {
 				if (obj) {
@@ -377,7 +385,13 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 						}
 
 						if (set_valid) {
-							node->set(snames[nprops[j].name], value, &valid);
+							// Nodes created from the plan are of the class the setters were resolved for, until a script is attached.
+							const ClassDB::PropertySetGet *setter = created_from_plan && use_plan_setters && !node->get_script_instance() ? node_plan.setters[j] : nullptr;
+							if (setter) {
+								ClassDB::call_property_setter(node, *setter, value, &valid);
+							} else {
+								node->set(snames[nprops[j].name], value, &valid);
+							}
 						}
 					}
 				}
@@ -530,13 +544,7 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 		if (c.unbinds > 0) {
 			callable = callable.unbind(c.unbinds);
 		} else if (!c.binds.is_empty()) {
-			Vector<Variant> binds;
-			if (c.binds.size()) {
-				binds.resize(c.binds.size());
-				for (int j = 0; j < c.binds.size(); j++) {
-					binds.write[j] = props[c.binds[j]];
-				}
-			}
+			const Vector<Variant> &binds = plan.connection_binds[i];
 
 			const Variant **argptrs = (const Variant **)alloca(sizeof(Variant *) * binds.size());
 			for (int j = 0; j < binds.size(); j++) {
@@ -566,6 +574,290 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 	return ret_nodes[0];
 }
 
+const SceneState::InstantiationPlan &SceneState::_get_instantiation_plan() const {
+	if (instantiation_plan_ready.is_set()) {
+		return instantiation_plan;
+	}
+
+	MutexLock lock(instantiation_plan_mutex);
+	if (instantiation_plan_ready.is_set()) {
+		return instantiation_plan; // Compiled by another thread meanwhile.
+	}
+
+	InstantiationPlan &plan = instantiation_plan;
+	plan.nodes.clear();
+	plan.nodes.resize(nodes.size());
+
+	for (int i = 0; i < nodes.size(); i++) {
+		const NodeData &n = nodes[i];
+		if ((i == 0 && base_scene_idx >= 0) || n.instance >= 0 || n.type == TYPE_INSTANTIATED || n.type < 0 || n.type >= names.size()) {
+			continue; // Not created by this scene.
+		}
+
+		InstantiationPlan::NodePlan &node_plan = plan.nodes[i];
+		const StringName &type = names[n.type];
+		node_plan.creation_func = ClassDB::get_native_creation_func(type);
+		if (!node_plan.creation_func) {
+			continue;
+		}
+
+		node_plan.setters.resize(n.properties.size());
+		for (int j = 0; j < n.properties.size(); j++) {
+			const NodeData::Property &prop = n.properties[j];
+			node_plan.setters[j] = nullptr;
+			if ((prop.name & FLAG_PATH_PROPERTY_IS_NODE) || prop.name < 0 || prop.name >= names.size() || names[prop.name] == CoreStringNames::get_singleton()->_script) {
+				continue;
+			}
+			node_plan.setters[j] = ClassDB::get_native_property_setget(type, names[prop.name]);
+		}
+	}
+
+	plan.connection_binds.clear();
+	plan.connection_binds.resize(connections.size());
+	for (int i = 0; i < connections.size(); i++) {
+		const ConnectionData &c = connections[i];
+		Vector<Variant> &binds = plan.connection_binds[i];
+		binds.resize(c.binds.size());
+		for (int j = 0; j < c.binds.size(); j++) {
+			ERR_CONTINUE(c.binds[j] < 0 || c.binds[j] >= variants.size());
+			binds.write[j] = variants[c.binds[j]];
+		}
+	}
+
+	instantiation_plan_ready.set();
+	return plan;
+}
+
+void SceneState::_clear_instantiation_plan() {
+	MutexLock lock(instantiation_plan_mutex);
+	instantiation_plan_ready.clear();
+	instantiation_plan.nodes.clear();
+	instantiation_plan.connection_binds.clear();
+}
+
+void SceneState::_get_reset_defaults(int p_idx, Node *p_node, LocalVector<Pair<StringName, Variant>> &r_defaults) const {
+	_get_instantiation_plan();
+
+	MutexLock lock(instantiation_plan_mutex);
+	InstantiationPlan::NodePlan &node_plan = instantiation_plan.nodes[p_idx];
+	if (!node_plan.reset_defaults_ready) {
+		// Gathered from the first node reset, as script properties are only known once the script is attached.
+		const NodeData &n = nodes[p_idx];
+		Ref<Script> scr = p_node->get_script();
+
+		List<PropertyInfo> plist;
+		p_node->get_property_list(&plist);
+		for (const PropertyInfo &E : plist) {
+			if (!(E.usage & PROPERTY_USAGE_STORAGE) || (E.usage & (PROPERTY_USAGE_CATEGORY | PROPERTY_USAGE_GROUP | PROPERTY_USAGE_SUBGROUP))) {
+				continue;
+			}
+			if (E.name == CoreStringNames::get_singleton()->_script) {
+				continue;
+			}
+
+			bool saved = false;
+			for (const NodeData::Property &prop : n.properties) {
+				if (names[prop.name & FLAG_PROP_NAME_MASK] == E.name) {
+					saved = true;
+					break;
+				}
+			}
+			if (saved) {
+				continue; // Restored from the scene itself.
+			}
+
+			Variant default_value;
+			bool valid = scr.is_valid() && scr->get_property_default_value(E.name, default_value);
+			if (!valid) {
+				default_value = ClassDB::class_get_default_property_value(p_node->get_class_name(), E.name, &valid);
+			}
+			if (valid) {
+				node_plan.reset_defaults.push_back(Pair<StringName, Variant>(E.name, default_value));
+			}
+		}
+		node_plan.reset_defaults_ready = true;
+	}
+
+	r_defaults = node_plan.reset_defaults;
+}
+
+void SceneState::_free_runtime_nodes(Node *p_root, Node *p_node) {
+	// Groups saved in the scene are persistent, and are added back by _reset_instance().
+	List<Node::GroupInfo> groups;
+	p_node->get_groups(&groups);
+	for (const Node::GroupInfo &E : groups) {
+		if (!E.persistent) {
+			p_node->remove_from_group(E.name);
+		}
+	}
+
+	// Every node of the scene, including those of its instances, is owned by another node of the instance.
+	for (int i = p_node->get_child_count(false) - 1; i >= 0; i--) {
+		Node *child = p_node->get_child(i, false);
+		Node *owner = child->get_owner();
+		if (owner && (owner == p_root || p_root->is_ancestor_of(owner))) {
+			_free_runtime_nodes(p_root, child);
+		} else {
+			p_node->remove_child(child);
+			memdelete(child);
+		}
+	}
+}
+
+Error SceneState::reset_instance(Node *p_root) const {
+	ERR_FAIL_NULL_V(p_root, ERR_INVALID_PARAMETER);
+	ERR_FAIL_COND_V(nodes.is_empty(), ERR_UNCONFIGURED);
+
+	_free_runtime_nodes(p_root, p_root);
+	return _reset_instance(p_root);
+}
+
+Error SceneState::_reset_instance(Node *p_root) const {
+	int nc = nodes.size();
+	ERR_FAIL_COND_V(nc == 0, ERR_UNCONFIGURED);
+
+	if (base_scene_idx >= 0) {
+		// Inherited scene, bring back the base scene first and apply this scene's changes on top.
+		Ref<PackedScene> sdata = variants[base_scene_idx];
+		ERR_FAIL_COND_V(sdata.is_null(), ERR_CANT_RESOLVE);
+		Error err = sdata->get_state()->_reset_instance(p_root);
+		if (err != OK) {
+			return err;
+		}
+	}
+
+	Node **ret_nodes = (Node **)alloca(sizeof(Node *) * nc);
+	LocalVector<DeferredNodePathProperties> deferred_node_paths;
+	LocalVector<Pair<StringName, Variant>> reset_defaults;
+
+	for (int i = 0; i < nc; i++) {
+		const NodeData &n = nodes[i];
+
+		Node *node = nullptr;
+		if (i == 0) {
+			node = p_root;
+		} else {
+			Node *parent = nullptr;
+			if (n.parent & FLAG_ID_IS_PATH) {
+				parent = p_root->get_node_or_null(node_paths[n.parent & FLAG_MASK]);
+			} else if (n.parent >= 0 && n.parent < i) {
+				parent = ret_nodes[n.parent];
+			}
+			if (parent) {
+				node = parent->_get_child_by_name(names[n.name]);
+			}
+		}
+
+		ret_nodes[i] = node;
+		if (!node) {
+			if (n.type == TYPE_INSTANTIATED && n.instance < 0) {
+				continue; // Had already vanished from its instance when this scene was instantiated.
+			}
+			return ERR_DOES_NOT_EXIST; // The structure of the instance changed, it can't be reset.
+		}
+
+		if (n.instance >= 0) {
+			if (n.instance & FLAG_INSTANCE_IS_PLACEHOLDER) {
+				return ERR_UNAVAILABLE; // Placeholders may have been replaced by their scene.
+			}
+			Ref<PackedScene> sdata = variants[n.instance & FLAG_MASK];
+			ERR_FAIL_COND_V(sdata.is_null(), ERR_CANT_RESOLVE);
+			Error err = sdata->get_state()->_reset_instance(node);
+			if (err != OK) {
+				return err;
+			}
+		}
+
+		Variant scene_script;
+		for (const NodeData::Property &prop : n.properties) {
+			if (!(prop.name & FLAG_PATH_PROPERTY_IS_NODE) && names[prop.name] == CoreStringNames::get_singleton()->_script) {
+				scene_script = variants[prop.value];
+				break;
+			}
+		}
+		if (!scene_script.is_null() && node->get_script() != scene_script) {
+			return ERR_INVALID_DATA; // Swapping the script back would rebuild the script instance anyway.
+		}
+
+		for (int j = 0; j < n.groups.size(); j++) {
+			node->add_to_group(names[n.groups[j]], true);
+		}
+
+		bool created_here = n.instance < 0 && n.type != TYPE_INSTANTIATED && !(i == 0 && base_scene_idx >= 0);
+		if (created_here && n.type >= 0 && n.type < names.size() && node->get_class_name() == names[n.type]) {
+			if (scene_script.is_null() && !node->get_script().is_null()) {
+				return ERR_INVALID_DATA;
+			}
+			_get_reset_defaults(i, node, reset_defaults);
+			for (const Pair<StringName, Variant> &E : reset_defaults) {
+				if (node->get(E.first) != E.second) {
+					node->set(E.first, E.second.duplicate(true));
+				}
+			}
+		}
+
+		for (const NodeData::Property &prop : n.properties) {
+			if (prop.name & FLAG_PATH_PROPERTY_IS_NODE) {
+				DeferredNodePathProperties dnp;
+				dnp.value = variants[prop.value];
+				dnp.base = node;
+				dnp.property = names[prop.name & FLAG_PROP_NAME_MASK];
+				deferred_node_paths.push_back(dnp);
+				continue;
+			}
+
+			const StringName &pname = names[prop.name];
+			if (pname == CoreStringNames::get_singleton()->_script) {
+				continue;
+			}
+
+			const Variant &value = variants[prop.value];
+			if (value.get_type() == Variant::OBJECT) {
+				Ref<Resource> res = value;
+				if (res.is_valid() && res->is_local_to_scene()) {
+					continue; // The instance keeps its own copy.
+				}
+			}
+			Variant current = node->get(pname);
+			if (current == value) {
+				continue;
+			}
+
+			// Arrays and dictionaries may have been modified in place, so the instance gets its own copy.
+			Variant new_value = value.get_type() == Variant::OBJECT ? value : value.duplicate(true);
+			if (new_value.get_type() == Variant::ARRAY && current.get_type() == Variant::ARRAY) {
+				Array set_array = new_value;
+				Array get_array = current;
+				if (!set_array.is_same_typed(get_array)) {
+					new_value = Array(set_array, get_array.get_typed_builtin(), get_array.get_typed_class_name(), get_array.get_typed_script());
+				}
+			}
+			node->set(pname, new_value);
+		}
+	}
+
+	for (const DeferredNodePathProperties &dnp : deferred_node_paths) {
+		if (dnp.value.get_type() == Variant::ARRAY) {
+			Array paths = dnp.value;
+
+			bool valid;
+			Array array = dnp.base->get(dnp.property, &valid);
+			ERR_CONTINUE(!valid);
+			array = array.duplicate();
+
+			array.resize(paths.size());
+			for (int i = 0; i < array.size(); i++) {
+				array.set(i, dnp.base->get_node_or_null(paths[i]));
+			}
+			dnp.base->set(dnp.property, array);
+		} else {
+			dnp.base->set(dnp.property, dnp.base->get_node_or_null(dnp.value));
+		}
+	}
+
+	return OK;
+}
+
 static int _nm_get_string(const String &p_string, HashMap<StringName, int> &name_map) {
 	if (name_map.has(p_string)) {
 		return name_map[p_string];
@@ -1120,6 +1412,7 @@ String SceneState::get_path() const {
 }
 
 void SceneState::clear() {
+	_clear_instantiation_plan();
 	names.clear();
 	variants.clear();
 	nodes.clear();
@@ -1174,6 +1467,7 @@ Ref<SceneState> SceneState::get_base_scene_state() const {
 
 void SceneState::update_instance_resource(String p_path, Ref<PackedScene> p_packed_scene) {
 	ERR_FAIL_COND(p_packed_scene.is_null());
+	_clear_instantiation_plan();
 
 	for (const NodeData &nd : nodes) {
 		if (nd.instance >= 0) {
@@ -1335,6 +1629,8 @@ void SceneState::set_bundled_scene(const Dictionary &p_dictionary) {
 
 	ERR_FAIL_COND_MSG(version > PACKED_SCENE_VERSION, "Save format version too new.");
 
+	_clear_instantiation_plan();
+
 	const int node_count = p_dictionary["node_count"];
 	const Vector<int> snodes = p_dictionary["nodes"];
 	ERR_FAIL_COND(snodes.size() < node_count);
@@ -1774,11 +2070,13 @@ Vector<NodePath> SceneState::get_editable_instances() const {
 //add
 
 int SceneState::add_name(const StringName &p_name) {
+	_clear_instantiation_plan();
 	names.push_back(p_name);
 	return names.size() - 1;
 }
 
 int SceneState::add_value(const Variant &p_value) {
+	_clear_instantiation_plan();
 	variants.push_back(p_value);
 	return variants.size() - 1;
 }
@@ -1789,6 +2087,7 @@ int SceneState::add_node_path(const NodePath &p_path) {
 }
 
 int SceneState::add_node(int p_parent, int p_owner, int p_type, int p_name, int p_instance, int p_index) {
+	_clear_instantiation_plan();
 	NodeData nd;
 	nd.parent = p_parent;
 	nd.owner = p_owner;
@@ -1806,6 +2105,7 @@ void SceneState::add_node_property(int p_node, int p_name, int p_value, bool p_d
 	ERR_FAIL_INDEX(p_node, nodes.size());
 	ERR_FAIL_INDEX(p_name, names.size());
 	ERR_FAIL_INDEX(p_value, variants.size());
+	_clear_instantiation_plan();
 
 	NodeData::Property prop;
 	prop.name = p_name;
@@ -1823,6 +2123,7 @@ void SceneState::add_node_group(int p_node, int p_group) {
 }
 
 void SceneState::set_base_scene(int p_idx) {
+	_clear_instantiation_plan();
 	ERR_FAIL_INDEX(p_idx, variants.size());
 	base_scene_idx = p_idx;
 }
@@ -1834,6 +2135,8 @@ void SceneState::add_connection(int p_from, int p_to, int p_signal, int p_method
 	for (int i = 0; i < p_binds.size(); i++) {
 		ERR_FAIL_INDEX(p_binds[i], variants.size());
 	}
+	_clear_instantiation_plan();
+
 	ConnectionData c;
 	c.from = p_from;
 	c.to = p_to;
@@ -1999,6 +2302,25 @@ Node *PackedScene::instantiate(GenEditState p_edit_state) const {
 	return s;
 }
 
+TypedArray<Node> PackedScene::instantiate_multiple(int p_count, GenEditState p_edit_state) const {
+	ERR_FAIL_COND_V(p_count < 0, TypedArray<Node>());
+
+	TypedArray<Node> ret;
+	ret.resize(p_count);
+	for (int i = 0; i < p_count; i++) {
+		Node *node = instantiate(p_edit_state);
+		if (!node) {
+			for (int j = 0; j < i; j++) {
+				memdelete(Object::cast_to<Node>(ret[j]));
+			}
+			return TypedArray<Node>();
+		}
+		ret[i] = node;
+	}
+
+	return ret;
+}
+
 void PackedScene::replace_state(Ref<SceneState> p_by) {
 	state = p_by;
 	state->set_path(get_path());
@@ -2030,6 +2352,7 @@ void PackedScene::reset_state() {
 void PackedScene::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("pack", "path"), &PackedScene::pack);
 	ClassDB::bind_method(D_METHOD("instantiate", "edit_state"), &PackedScene::instantiate, DEFVAL(GEN_EDIT_STATE_DISABLED));
+	ClassDB::bind_method(D_METHOD("instantiate_multiple", "count", "edit_state"), &PackedScene::instantiate_multiple, DEFVAL(GEN_EDIT_STATE_DISABLED));
 	ClassDB::bind_method(D_METHOD("can_instantiate"), &PackedScene::can_instantiate);
 	ClassDB::bind_method(D_METHOD("_set_bundled_scene", "scene"), &PackedScene::_set_bundled_scene);
 	ClassDB::bind_method(D_METHOD("_get_bundled_scene"), &PackedScene::_get_bundled_scene);
@@ -32,6 +32,9 @@
 #define PACKED_SCENE_H
 
 #include "core/io/resource.h"
+#include "core/os/mutex.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
 #include "scene/main/node.h"
 
 class SceneState : public RefCounted {
@@ -89,6 +92,29 @@ class SceneState : public RefCounted {
 
 	Vector<ConnectionData> connections;
 
+	// What instantiate() can resolve once instead of on every call, compiled on first use.
+	struct InstantiationPlan {
+		struct NodePlan {
+			ClassDB::NativeCreationFunc creation_func = nullptr; // Only set for nodes created by this scene.
+			LocalVector<const ClassDB::PropertySetGet *> setters; // One per property, nullptr if it must go through Object::set().
+			LocalVector<Pair<StringName, Variant>> reset_defaults; // Stored properties the scene leaves at their default, see reset_instance().
+			bool reset_defaults_ready = false;
+		};
+
+		LocalVector<NodePlan> nodes;
+		LocalVector<Vector<Variant>> connection_binds;
+	};
+
+	mutable InstantiationPlan instantiation_plan;
+	mutable SafeFlag instantiation_plan_ready;
+	mutable BinaryMutex instantiation_plan_mutex;
+
+	const InstantiationPlan &_get_instantiation_plan() const;
+	void _clear_instantiation_plan();
+	void _get_reset_defaults(int p_idx, Node *p_node, LocalVector<Pair<StringName, Variant>> &r_defaults) const;
+	static void _free_runtime_nodes(Node *p_root, Node *p_node);
+	Error _reset_instance(Node *p_root) const;
+
 	Error _parse_node(Node *p_owner, Node *p_node, int p_parent_idx, HashMap<StringName, int> &name_map, HashMap<Variant, int, VariantHasher, VariantComparator> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map);
 	Error _parse_connections(Node *p_owner, Node *p_node, HashMap<StringName, int> &name_map, HashMap<Variant, int, VariantHasher, VariantComparator> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map);
 
@@ -156,6 +182,9 @@ public:
 
 	bool can_instantiate() const;
 	Node *instantiate(GenEditState p_edit_state) const;
+	// Resets an instance of this scene in place to what instantiate() returns: properties and groups are restored,
+	// and children that aren't part of the scene are freed.
+	Error reset_instance(Node *p_root) const;
 
 	Ref<SceneState> get_base_scene_state() const;
 
@@ -251,6 +280,7 @@ public:
 
 	bool can_instantiate() const;
 	Node *instantiate(GenEditState p_edit_state = GEN_EDIT_STATE_DISABLED) const;
+	TypedArray<Node> instantiate_multiple(int p_count, GenEditState p_edit_state = GEN_EDIT_STATE_DISABLED) const;
 
 	void recreate_state();
 	void replace_state(Ref<SceneState> p_by);
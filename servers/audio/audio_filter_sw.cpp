@@ -241,6 +241,67 @@ void AudioFilterSW::Processor::update_coeffs(int p_interp_buffer_len) {
 	}
 }
 
+// Filters interleaved stereo samples, with this processor on the left channel and p_right on the right one.
+// Both channels run through the same loop body with their state side by side, so each one can use a SIMD lane.
+// The result is the same as calling process_one_interp() on each channel.
+void AudioFilterSW::Processor::process_stereo_interp(Processor *p_right, float *p_samples, int p_amount) {
+	ERR_FAIL_NULL(p_right);
+	Processor *lanes[2] = { this, p_right };
+
+	float b0[2], b1[2], b2[2], a1[2], a2[2];
+	float incr_b0[2], incr_b1[2], incr_b2[2], incr_a1[2], incr_a2[2];
+	float h_a1[2], h_a2[2], h_b1[2], h_b2[2];
+	for (int lane = 0; lane < 2; lane++) {
+		const Processor *p = lanes[lane];
+		b0[lane] = p->coeffs.b0;
+		b1[lane] = p->coeffs.b1;
+		b2[lane] = p->coeffs.b2;
+		a1[lane] = p->coeffs.a1;
+		a2[lane] = p->coeffs.a2;
+		incr_b0[lane] = p->incr_coeffs.b0;
+		incr_b1[lane] = p->incr_coeffs.b1;
+		incr_b2[lane] = p->incr_coeffs.b2;
+		incr_a1[lane] = p->incr_coeffs.a1;
+		incr_a2[lane] = p->incr_coeffs.a2;
+		h_a1[lane] = p->ha1;
+		h_a2[lane] = p->ha2;
+		h_b1[lane] = p->hb1;
+		h_b2[lane] = p->hb2;
+	}
+
+	for (int i = 0; i < p_amount; i++) {
+		float *frame = &p_samples[i * 2];
+		for (int lane = 0; lane < 2; lane++) {
+			float pre = frame[lane];
+			float out = (pre * b0[lane] + h_b1[lane] * b1[lane] + h_b2[lane] * b2[lane] + h_a1[lane] * a1[lane] + h_a2[lane] * a2[lane]);
+			h_a2[lane] = h_a1[lane];
+			h_b2[lane] = h_b1[lane];
+			h_b1[lane] = pre;
+			h_a1[lane] = out;
+			frame[lane] = out;
+
+			b0[lane] += incr_b0[lane];
+			b1[lane] += incr_b1[lane];
+			b2[lane] += incr_b2[lane];
+			a1[lane] += incr_a1[lane];
+			a2[lane] += incr_a2[lane];
+		}
+	}
+
+	for (int lane = 0; lane < 2; lane++) {
+		Processor *p = lanes[lane];
+		p->coeffs.b0 = b0[lane];
+		p->coeffs.b1 = b1[lane];
+		p->coeffs.b2 = b2[lane];
+		p->coeffs.a1 = a1[lane];
+		p->coeffs.a2 = a2[lane];
+		p->ha1 = h_a1[lane];
+		p->ha2 = h_a2[lane];
+		p->hb1 = h_b1[lane];
+		p->hb2 = h_b2[lane];
+	}
+}
+
 void AudioFilterSW::Processor::process(float *p_samples, int p_amount, int p_stride, bool p_interpolate) {
 	if (!filter) {
 		return;
@@ -68,6 +68,7 @@ public:
 		void set_filter(AudioFilterSW *p_filter, bool p_clear_history = true);
 		void process(float *p_samples, int p_amount, int p_stride = 1, bool p_interpolate = false);
 		void update_coeffs(int p_interp_buffer_len = 0);
+		void process_stereo_interp(Processor *p_right, float *p_samples, int p_amount);
 		_ALWAYS_INLINE_ void process_one(float &p_sample);
 		_ALWAYS_INLINE_ void process_one_interp(float &p_sample);
 
@@ -110,11 +110,134 @@ void AudioStreamPlaybackResampled::begin_resample() {
 	internal_buffer[1] = AudioFrame(0.0, 0.0);
 	internal_buffer[2] = AudioFrame(0.0, 0.0);
 	internal_buffer[3] = AudioFrame(0.0, 0.0);
+	discard_decoded_audio();
 	//mix buffer
-	_mix_internal(internal_buffer + 4, INTERNAL_BUFFER_LEN);
+	_mix_decoded(internal_buffer + 4);
 	mix_offset = 0;
 }
 
+void AudioStreamPlaybackResampled::enable_decode_ahead() {
+	if (decode_ahead || !AudioServer::get_singleton()->is_decode_ahead_enabled()) {
+		return;
+	}
+	decoded_chunks.resize(DECODE_AHEAD_CHUNKS);
+	decode_ahead = true;
+	AudioServer::get_singleton()->_register_decode_ahead(this);
+}
+
+AudioStreamPlaybackResampled::~AudioStreamPlaybackResampled() {
+	if (decode_ahead && AudioServer::get_singleton()) {
+		AudioServer::get_singleton()->_unregister_decode_ahead(this);
+	}
+}
+
+void AudioStreamPlaybackResampled::discard_decoded_audio() {
+	if (!decode_ahead) {
+		return;
+	}
+	decode_generation.increment();
+	decode_finished.clear();
+	mixed_to_end.clear();
+	mixed_position.set(_get_decoder_position());
+	mixed_loop_count.set(_get_decoder_loop_count());
+}
+
+void AudioStreamPlaybackResampled::stop_decode_ahead() {
+	if (!decode_ahead) {
+		return;
+	}
+	decode_generation.increment();
+	decode_finished.set();
+	mixed_to_end.set();
+}
+
+bool AudioStreamPlaybackResampled::has_decoded_audio_left() const {
+	return decode_ahead && decode_finished.is_set() && !mixed_to_end.is_set();
+}
+
+double AudioStreamPlaybackResampled::get_mixed_position() const {
+	return mixed_position.get();
+}
+
+int AudioStreamPlaybackResampled::get_mixed_loop_count() const {
+	return mixed_loop_count.get();
+}
+
+double AudioStreamPlaybackResampled::_get_decoder_position() const {
+	return 0.0;
+}
+
+int AudioStreamPlaybackResampled::_get_decoder_loop_count() const {
+	return 0;
+}
+
+void AudioStreamPlaybackResampled::_decode_ahead() {
+	while (true) {
+		// Locked for one chunk at a time, so mix() and seeking never wait for a whole refill.
+		MutexLock lock(decode_mutex);
+		if (decode_finished.is_set() || decoded_chunks_written.get() - decoded_chunks_read.get() >= DECODE_AHEAD_CHUNKS) {
+			break;
+		}
+		DecodedChunk &chunk = decoded_chunks[decoded_chunks_written.get() & (DECODE_AHEAD_CHUNKS - 1)];
+		chunk.generation = decode_generation.get();
+		chunk.frame_count = _mix_internal(chunk.frames, INTERNAL_BUFFER_LEN);
+		chunk.position = _get_decoder_position();
+		chunk.loop_count = _get_decoder_loop_count();
+		if (chunk.frame_count != INTERNAL_BUFFER_LEN) {
+			decode_finished.set();
+		}
+		// Publishes the chunk to mix().
+		decoded_chunks_written.increment();
+	}
+}
+
+bool AudioStreamPlaybackResampled::_pop_decoded_chunk(AudioFrame *p_buffer, int &r_mixed_frames) {
+	while (decoded_chunks_read.get() != decoded_chunks_written.get()) {
+		const DecodedChunk &chunk = decoded_chunks[decoded_chunks_read.get() & (DECODE_AHEAD_CHUNKS - 1)];
+		if (chunk.generation == decode_generation.get()) {
+			for (int i = 0; i < INTERNAL_BUFFER_LEN; i++) {
+				p_buffer[i] = chunk.frames[i];
+			}
+			r_mixed_frames = chunk.frame_count;
+			mixed_position.set(chunk.position);
+			mixed_loop_count.set(chunk.loop_count);
+			if (chunk.frame_count != INTERNAL_BUFFER_LEN) {
+				mixed_to_end.set();
+			}
+			decoded_chunks_read.increment();
+			return true;
+		}
+		// Decoded before a seek, skip it.
+		decoded_chunks_read.increment();
+	}
+	return false;
+}
+
+int AudioStreamPlaybackResampled::_mix_decoded(AudioFrame *p_buffer) {
+	if (!decode_ahead) {
+		return _mix_internal(p_buffer, INTERNAL_BUFFER_LEN);
+	}
+
+	int mixed_frames = 0;
+	if (!_pop_decoded_chunk(p_buffer, mixed_frames) && !decode_finished.is_set()) {
+		// The decoder threads fell behind, so decode on this thread as if decode-ahead was disabled.
+		// A decoder thread only holds the decoder for one chunk, so this waits for at most one chunk to decode.
+		MutexLock lock(decode_mutex);
+		// A decoder thread may have published the chunk while this thread was waiting.
+		if (!_pop_decoded_chunk(p_buffer, mixed_frames)) {
+			mixed_frames = _mix_internal(p_buffer, INTERNAL_BUFFER_LEN);
+			mixed_position.set(_get_decoder_position());
+			mixed_loop_count.set(_get_decoder_loop_count());
+			if (mixed_frames != INTERNAL_BUFFER_LEN) {
+				decode_finished.set();
+				mixed_to_end.set();
+			}
+		}
+	}
+
+	return mixed_frames;
+}
+
 int AudioStreamPlaybackResampled::_mix_internal(AudioFrame *p_buffer, int p_frames) {
 	int ret = 0;
 	GDVIRTUAL_REQUIRED_CALL(_mix_resampled, p_buffer, p_frames, ret);
@@ -172,7 +295,7 @@ int AudioStreamPlaybackResampled::mix(AudioFrame *p_buffer, float p_rate_scale,
 			internal_buffer[1] = internal_buffer[INTERNAL_BUFFER_LEN + 1];
 			internal_buffer[2] = internal_buffer[INTERNAL_BUFFER_LEN + 2];
 			internal_buffer[3] = internal_buffer[INTERNAL_BUFFER_LEN + 3];
-			int mixed_frames = _mix_internal(internal_buffer + 4, INTERNAL_BUFFER_LEN);
+			int mixed_frames = _mix_decoded(internal_buffer + 4);
 			if (mixed_frames != INTERNAL_BUFFER_LEN) {
 				// internal_buffer[mixed_frames] is the first frame of silence.
 				internal_buffer_end = mixed_frames;
@@ -186,6 +309,13 @@ int AudioStreamPlaybackResampled::mix(AudioFrame *p_buffer, float p_rate_scale,
 	if (mixed_frames_total == -1 && i == p_frames) {
 		mixed_frames_total = p_frames;
 	}
+
+	// Only wake a decoder thread once half of the ring was mixed. This is done after mixing, so the decoder
+	// doesn't compete for decode_mutex with the chunks this mix still needs, e.g. right after a seek.
+	if (decode_ahead && !decode_finished.is_set() && decoded_chunks_written.get() - decoded_chunks_read.get() <= DECODE_AHEAD_CHUNKS / 2 && !decode_ahead_requested.exchange(true)) {
+		AudioServer::get_singleton()->_request_decode_ahead();
+	}
+
 	return mixed_frames_total;
 }
 
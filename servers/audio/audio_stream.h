@@ -84,19 +84,62 @@ class AudioStreamPlaybackResampled : public AudioStreamPlayback {
 		FP_LEN = (1 << FP_BITS),
 		FP_MASK = FP_LEN - 1,
 		INTERNAL_BUFFER_LEN = 128, // 128 warrants 3ms positional jitter at much at 44100hz
-		CUBIC_INTERP_HISTORY = 4
+		CUBIC_INTERP_HISTORY = 4,
+		DECODE_AHEAD_CHUNKS = 32, // Must be a power of 2. 32 chunks of INTERNAL_BUFFER_LEN are about 90ms at 44100hz.
 	};
 
 	AudioFrame internal_buffer[INTERNAL_BUFFER_LEN + CUBIC_INTERP_HISTORY];
 	unsigned int internal_buffer_end = -1;
 	uint64_t mix_offset = 0;
 
+	// Decode-ahead: a ring of chunks decoded by the AudioServer's decoder threads (the producer), copied by mix() (the consumer).
+	struct DecodedChunk {
+		AudioFrame frames[INTERNAL_BUFFER_LEN];
+		int frame_count = 0;
+		uint32_t generation = 0; // Chunks decoded before the last discard_decoded_audio() are skipped.
+		double position = 0.0; // Decoder state after decoding this chunk.
+		int loop_count = 0;
+	};
+
+	bool decode_ahead = false;
+	LocalVector<DecodedChunk> decoded_chunks;
+	SafeNumeric<uint32_t> decoded_chunks_read;
+	SafeNumeric<uint32_t> decoded_chunks_written;
+	SafeNumeric<uint32_t> decode_generation;
+	std::atomic<bool> decode_ahead_requested = false; // Set by mix() to ask for a refill, cleared by the decoder thread that picks it up.
+	SafeFlag decode_finished; // The decoder returned a short chunk, so there's nothing more to decode until it's restarted.
+	SafeFlag mixed_to_end; // mix() copied that short chunk.
+	SafeNumeric<double> mixed_position;
+	SafeNumeric<int> mixed_loop_count;
+
+	friend class AudioServer;
+	friend class TestAudioServerInternalsAccessor;
+	void _decode_ahead(); // Called on a decoder thread.
+	bool _pop_decoded_chunk(AudioFrame *p_buffer, int &r_mixed_frames);
+	int _mix_decoded(AudioFrame *p_buffer);
+
 protected:
 	void begin_resample();
 	// Returns the number of frames that were mixed.
 	virtual int _mix_internal(AudioFrame *p_buffer, int p_frames);
 	virtual float get_stream_sampling_rate();
 
+	// With decode-ahead enabled, _mix_internal() is called on a decoder thread ahead of time, and mix() only copies what was decoded.
+	// Subclasses must lock decode_mutex around anything else that touches the decoder, call discard_decoded_audio() when it seeks,
+	// and stop_decode_ahead() when it stops.
+	Mutex decode_mutex;
+	void enable_decode_ahead(); // Does nothing if the AudioServer has no decoder threads.
+	_FORCE_INLINE_ bool is_decoding_ahead() const { return decode_ahead; }
+	void discard_decoded_audio();
+	void stop_decode_ahead();
+	// Whether the decoder reached the end of the stream but mix() hasn't caught up yet.
+	bool has_decoded_audio_left() const;
+	// Decoder position and loop count matching what mix() last copied, rather than what was last decoded.
+	double get_mixed_position() const;
+	int get_mixed_loop_count() const;
+	virtual double _get_decoder_position() const;
+	virtual int _get_decoder_loop_count() const;
+
 	GDVIRTUAL2R(int, _mix_resampled, GDExtensionPtr<AudioFrame>, int)
 	GDVIRTUAL0RC(float, _get_stream_sampling_rate)
 
@@ -106,6 +149,7 @@ public:
 	virtual int mix(AudioFrame *p_buffer, float p_rate_scale, int p_frames) override;
 
 	AudioStreamPlaybackResampled() { mix_offset = 0; }
+	~AudioStreamPlaybackResampled();
 };
 
 class AudioStream : public Resource {
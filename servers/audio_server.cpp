@@ -36,12 +36,14 @@
 #include "core/io/file_access.h"
 #include "core/io/resource_loader.h"
 #include "core/math/audio_frame.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 #include "core/string/string_name.h"
 #include "core/templates/pair.h"
 #include "scene/resources/audio_stream_wav.h"
 #include "scene/scene_string_names.h"
 #include "servers/audio/audio_driver_dummy.h"
+#include "servers/audio/audio_stream.h"
 #include "servers/audio/effects/audio_effect_compressor.h"
 
 #include <cstring>
@@ -52,6 +54,11 @@
 #define MARK_EDITED
 #endif
 
+// How much louder than the threshold, or than a real voice, a virtual voice has to get to become real again.
+static const float VIRTUAL_VOICE_HYSTERESIS_DB = 3.0f;
+// How long a voice keeps its state after becoming virtual or real, in seconds.
+static const float VIRTUAL_VOICE_HOLD_TIME = 0.25f;
+
 AudioDriver *AudioDriver::singleton = nullptr;
 AudioDriver *AudioDriver::get_singleton() {
 	return singleton;
@@ -361,13 +368,33 @@ void AudioServer::_mix_step() {
 		ci->callback(ci->userdata);
 	}
 
+	_update_virtual_voices();
+	uint32_t real_count = 0;
+	uint32_t virtual_count = 0;
+
 	for (AudioStreamPlaybackListNode *playback : playback_list) {
 		// Paused streams are no-ops. Don't even mix audio from the stream playback.
 		if (playback->state.load() == AudioStreamPlaybackListNode::PAUSED) {
 			continue;
 		}
 
-		bool fading_out = playback->state.load() == AudioStreamPlaybackListNode::FADE_OUT_TO_DELETION || playback->state.load() == AudioStreamPlaybackListNode::FADE_OUT_TO_PAUSE;
+		// Virtual voices are still mixed so their position advances and they can end, but they aren't sent to any bus.
+		// Once audible again, they fade back in from the previous (silent) volume.
+		const bool mix_to_buses = !(playback->should_virtualize && playback->is_virtual);
+		if (playback->is_virtual != playback->should_virtualize) {
+			playback->is_virtual = playback->should_virtualize;
+			playback->virtual_hold_until_frame = mix_frames + virtual_voice_hold_frames;
+		}
+		if (playback->state.load() == AudioStreamPlaybackListNode::PLAYING) {
+			if (playback->is_virtual) {
+				virtual_count++;
+			} else {
+				real_count++;
+			}
+		}
+
+		// A voice becoming virtual is faded out in this mix, like a stopping one.
+		bool fading_out = playback->is_virtual || playback->state.load() == AudioStreamPlaybackListNode::FADE_OUT_TO_DELETION || playback->state.load() == AudioStreamPlaybackListNode::FADE_OUT_TO_PAUSE;
 
 		AudioFrame *buf = mix_buffer.ptrw();
 
@@ -404,74 +431,76 @@ void AudioServer::_mix_step() {
 			}
 		}
 
-		AudioStreamPlaybackBusDetails *ptr = playback->bus_details.load();
-		ERR_FAIL_NULL(ptr);
-		// By putting null into the bus details pointers, we're taking ownership of their memory for the duration of this mix.
-		AudioStreamPlaybackBusDetails bus_details = *ptr;
+		if (mix_to_buses) {
+			AudioStreamPlaybackBusDetails *ptr = playback->bus_details.load();
+			ERR_FAIL_NULL(ptr);
+			// By putting null into the bus details pointers, we're taking ownership of their memory for the duration of this mix.
+			AudioStreamPlaybackBusDetails bus_details = *ptr;
 
-		// Mix to any active buses.
-		for (int idx = 0; idx < MAX_BUSES_PER_PLAYBACK; idx++) {
-			if (!bus_details.bus_active[idx]) {
-				continue;
-			}
-			int bus_idx = thread_find_bus_index(bus_details.bus[idx]);
-
-			int prev_bus_idx = -1;
-			for (int search_idx = 0; search_idx < MAX_BUSES_PER_PLAYBACK; search_idx++) {
-				if (!playback->prev_bus_details->bus_active[search_idx]) {
+			// Mix to any active buses.
+			for (int idx = 0; idx < MAX_BUSES_PER_PLAYBACK; idx++) {
+				if (!bus_details.bus_active[idx]) {
 					continue;
 				}
-				if (playback->prev_bus_details->bus[search_idx].hash() == bus_details.bus[idx].hash()) {
-					prev_bus_idx = search_idx;
-				}
-			}
+				int bus_idx = thread_find_bus_index(bus_details.bus[idx]);
 
-			for (int channel_idx = 0; channel_idx < channel_count; channel_idx++) {
-				AudioFrame *channel_buf = thread_get_channel_mix_buffer(bus_idx, channel_idx);
-				if (fading_out) {
-					bus_details.volume[idx][channel_idx] = AudioFrame(0, 0);
+				int prev_bus_idx = -1;
+				for (int search_idx = 0; search_idx < MAX_BUSES_PER_PLAYBACK; search_idx++) {
+					if (!playback->prev_bus_details->bus_active[search_idx]) {
+						continue;
+					}
+					if (playback->prev_bus_details->bus[search_idx].hash() == bus_details.bus[idx].hash()) {
+						prev_bus_idx = search_idx;
+					}
 				}
-				AudioFrame channel_vol = bus_details.volume[idx][channel_idx];
 
-				AudioFrame prev_channel_vol = AudioFrame(0, 0);
-				if (prev_bus_idx != -1) {
-					prev_channel_vol = playback->prev_bus_details->volume[prev_bus_idx][channel_idx];
+				for (int channel_idx = 0; channel_idx < channel_count; channel_idx++) {
+					AudioFrame *channel_buf = thread_get_channel_mix_buffer(bus_idx, channel_idx);
+					if (fading_out) {
+						bus_details.volume[idx][channel_idx] = AudioFrame(0, 0);
+					}
+					AudioFrame channel_vol = bus_details.volume[idx][channel_idx];
+
+					AudioFrame prev_channel_vol = AudioFrame(0, 0);
+					if (prev_bus_idx != -1) {
+						prev_channel_vol = playback->prev_bus_details->volume[prev_bus_idx][channel_idx];
+					}
+					_mix_step_for_channel(channel_buf, buf, prev_channel_vol, channel_vol, playback->attenuation_filter_cutoff_hz.get(), playback->highshelf_gain.get(), &playback->filter_process[channel_idx * 2], &playback->filter_process[channel_idx * 2 + 1]);
 				}
-				_mix_step_for_channel(channel_buf, buf, prev_channel_vol, channel_vol, playback->attenuation_filter_cutoff_hz.get(), playback->highshelf_gain.get(), &playback->filter_process[channel_idx * 2], &playback->filter_process[channel_idx * 2 + 1]);
 			}
-		}
 
-		// Now go through and fade-out any buses that were being played to previously that we missed by going through current data.
-		for (int idx = 0; idx < MAX_BUSES_PER_PLAYBACK; idx++) {
-			if (!playback->prev_bus_details->bus_active[idx]) {
-				continue;
-			}
-			int bus_idx = thread_find_bus_index(playback->prev_bus_details->bus[idx]);
+			// Now go through and fade-out any buses that were being played to previously that we missed by going through current data.
+			for (int idx = 0; idx < MAX_BUSES_PER_PLAYBACK; idx++) {
+				if (!playback->prev_bus_details->bus_active[idx]) {
+					continue;
+				}
+				int bus_idx = thread_find_bus_index(playback->prev_bus_details->bus[idx]);
 
-			int current_bus_idx = -1;
-			for (int search_idx = 0; search_idx < MAX_BUSES_PER_PLAYBACK; search_idx++) {
-				if (bus_details.bus[search_idx] == playback->prev_bus_details->bus[idx]) {
-					current_bus_idx = search_idx;
+				int current_bus_idx = -1;
+				for (int search_idx = 0; search_idx < MAX_BUSES_PER_PLAYBACK; search_idx++) {
+					if (bus_details.bus[search_idx] == playback->prev_bus_details->bus[idx]) {
+						current_bus_idx = search_idx;
+					}
+				}
+				if (current_bus_idx != -1) {
+					// If we found a corresponding bus in the current bus assignments, we've already mixed to this bus.
+					continue;
 				}
-			}
-			if (current_bus_idx != -1) {
-				// If we found a corresponding bus in the current bus assignments, we've already mixed to this bus.
-				continue;
-			}
 
-			for (int channel_idx = 0; channel_idx < channel_count; channel_idx++) {
-				AudioFrame *channel_buf = thread_get_channel_mix_buffer(bus_idx, channel_idx);
-				AudioFrame prev_channel_vol = playback->prev_bus_details->volume[idx][channel_idx];
-				// Fade out to silence
-				_mix_step_for_channel(channel_buf, buf, prev_channel_vol, AudioFrame(0, 0), playback->attenuation_filter_cutoff_hz.get(), playback->highshelf_gain.get(), &playback->filter_process[channel_idx * 2], &playback->filter_process[channel_idx * 2 + 1]);
+				for (int channel_idx = 0; channel_idx < channel_count; channel_idx++) {
+					AudioFrame *channel_buf = thread_get_channel_mix_buffer(bus_idx, channel_idx);
+					AudioFrame prev_channel_vol = playback->prev_bus_details->volume[idx][channel_idx];
+					// Fade out to silence
+					_mix_step_for_channel(channel_buf, buf, prev_channel_vol, AudioFrame(0, 0), playback->attenuation_filter_cutoff_hz.get(), playback->highshelf_gain.get(), &playback->filter_process[channel_idx * 2], &playback->filter_process[channel_idx * 2 + 1]);
+				}
 			}
-		}
 
-		// Copy the bus details we mixed with to the previous bus details to maintain volume ramps.
-		std::copy(std::begin(bus_details.bus_active), std::end(bus_details.bus_active), std::begin(playback->prev_bus_details->bus_active));
-		std::copy(std::begin(bus_details.bus), std::end(bus_details.bus), std::begin(playback->prev_bus_details->bus));
-		for (int bus_idx = 0; bus_idx < MAX_BUSES_PER_PLAYBACK; bus_idx++) {
-			std::copy(std::begin(bus_details.volume[bus_idx]), std::end(bus_details.volume[bus_idx]), std::begin(playback->prev_bus_details->volume[bus_idx]));
+			// Copy the bus details we mixed with to the previous bus details to maintain volume ramps.
+			std::copy(std::begin(bus_details.bus_active), std::end(bus_details.bus_active), std::begin(playback->prev_bus_details->bus_active));
+			std::copy(std::begin(bus_details.bus), std::end(bus_details.bus), std::begin(playback->prev_bus_details->bus));
+			for (int bus_idx = 0; bus_idx < MAX_BUSES_PER_PLAYBACK; bus_idx++) {
+				std::copy(std::begin(bus_details.volume[bus_idx]), std::end(bus_details.volume[bus_idx]), std::begin(playback->prev_bus_details->volume[bus_idx]));
+			}
 		}
 
 		switch (playback->state.load()) {
@@ -499,131 +528,228 @@ void AudioServer::_mix_step() {
 		}
 	}
 
+	// Every bus sends to a bus before it, so a bus can be processed once the buses after it that
+	// send to it are. Buses that don't depend on each other are grouped into levels.
 	for (int i = buses.size() - 1; i >= 0; i--) {
-		//go bus by bus
 		Bus *bus = buses[i];
+		bus->sources.clear();
+		bus->level = 0;
+	}
+	for (int i = buses.size() - 1; i > 0; i--) {
+		Bus *bus = buses[i];
+		//everything has a send save for master bus
+		Bus *send = buses[0];
+		if (bus_map.has(bus->send)) {
+			send = bus_map[bus->send];
+			if (send->index_cache >= bus->index_cache) { //invalid, send to master
+				send = buses[0];
+			}
+		}
+		send->sources.push_back(bus);
+		send->level = MAX(send->level, bus->level + 1);
+	}
 
-		for (int k = 0; k < bus->channels.size(); k++) {
-			if (bus->channels[k].active && !bus->channels[k].used) {
-				//buffer was not used, but it's still active, so it must be cleaned
-				AudioFrame *buf = bus->channels.write[k].buffer.ptrw();
+	bus_schedule.clear();
+	bus_schedule_levels.clear();
+	for (int level = 0; bus_schedule.size() < (uint32_t)buses.size(); level++) {
+		bus_schedule_levels.push_back(bus_schedule.size());
+		for (int i = buses.size() - 1; i >= 0; i--) {
+			if (buses[i]->level == level) {
+				bus_schedule.push_back(buses[i]);
+			}
+		}
+	}
+	bus_schedule_levels.push_back(bus_schedule.size());
 
-				for (uint32_t j = 0; j < buffer_size; j++) {
-					buf[j] = AudioFrame(0, 0);
-				}
+	mix_solo_mode = solo_mode;
+	for (uint32_t i = 0; i + 1 < bus_schedule_levels.size(); i++) {
+		const uint32_t from = bus_schedule_levels[i];
+		const uint32_t count = bus_schedule_levels[i + 1] - from;
+		if (threaded_bus_processing && count > 1) {
+			WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_template_group_task(this, &AudioServer::_process_bus_task, &bus_schedule[from], count, -1, true);
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+		} else {
+			for (uint32_t j = from; j < from + count; j++) {
+				_process_bus(bus_schedule[j]);
 			}
 		}
+	}
 
-		//process effects
-		if (!bus->bypass) {
-			for (int j = 0; j < bus->effects.size(); j++) {
-				if (!bus->effects[j].enabled) {
-					continue;
-				}
+	real_voice_count.set(real_count);
+	virtual_voice_count.set(virtual_count);
 
-#ifdef DEBUG_ENABLED
-				uint64_t ticks = OS::get_singleton()->get_ticks_usec();
-#endif
+	mix_frames += buffer_size;
+	to_mix = buffer_size;
+}
 
-				for (int k = 0; k < bus->channels.size(); k++) {
-					if (!(bus->channels[k].active || bus->channels[k].effect_instances[j]->process_silence())) {
-						continue;
-					}
-					bus->channels.write[k].effect_instances.write[j]->process(bus->channels[k].buffer.ptr(), temp_buffer.write[k].ptrw(), buffer_size);
-				}
+void AudioServer::_update_virtual_voices() {
+	voice_candidates.clear();
 
-				//swap buffers, so internal buffer always has the right data
-				for (int k = 0; k < bus->channels.size(); k++) {
-					if (!(buses[i]->channels[k].active || bus->channels[k].effect_instances[j]->process_silence())) {
-						continue;
-					}
-					SWAP(bus->channels.write[k].buffer, temp_buffer.write[k]);
-				}
+	for (AudioStreamPlaybackListNode *playback : playback_list) {
+		playback->should_virtualize = false;
+		if (!voice_virtualization || playback->state.load() != AudioStreamPlaybackListNode::PLAYING) {
+			continue;
+		}
 
-#ifdef DEBUG_ENABLED
-				bus->effects.write[j].prof_time += OS::get_singleton()->get_ticks_usec() - ticks;
-#endif
+		const AudioStreamPlaybackBusDetails *details = playback->bus_details.load();
+		ERR_CONTINUE(!details);
+		float loudness = 0.0f;
+		for (int idx = 0; idx < MAX_BUSES_PER_PLAYBACK; idx++) {
+			if (!details->bus_active[idx]) {
+				continue;
+			}
+			for (int channel_idx = 0; channel_idx < channel_count; channel_idx++) {
+				loudness = MAX(loudness, MAX(details->volume[idx][channel_idx].l, details->volume[idx][channel_idx].r));
 			}
 		}
+		// A virtual voice has to get louder than a real one by the hysteresis margin to take its place,
+		// so voices near the threshold or near each other at the budget don't switch state every mix.
+		playback->loudness = playback->is_virtual ? loudness : loudness * virtual_voice_hysteresis_linear;
 
-		//process send
+		if (playback->loudness < virtual_voice_threshold_linear * virtual_voice_hysteresis_linear) {
+			playback->should_virtualize = true;
+		} else {
+			voice_candidates.push_back(playback);
+		}
+	}
 
-		Bus *send = nullptr;
+	// Over the budget, the quietest voices are the ones that are virtualized.
+	if (max_real_voices > 0 && voice_candidates.size() > (uint32_t)max_real_voices) {
+		voice_candidates.sort_custom<PlaybackLoudnessComparator>();
+		for (uint32_t i = max_real_voices; i < voice_candidates.size(); i++) {
+			voice_candidates[i]->should_virtualize = true;
+		}
+	}
 
-		if (i > 0) {
-			//everything has a send save for master bus
-			if (!bus_map.has(bus->send)) {
-				send = buses[0];
-			} else {
-				send = bus_map[bus->send];
-				if (send->index_cache >= bus->index_cache) { //invalid, send to master
-					send = buses[0];
-				}
-			}
+	// A voice that just switched keeps its state for a while, so it isn't faded out and in again right away.
+	for (AudioStreamPlaybackListNode *playback : playback_list) {
+		if (playback->should_virtualize != playback->is_virtual && mix_frames < playback->virtual_hold_until_frame) {
+			playback->should_virtualize = playback->is_virtual;
 		}
+	}
+}
 
-		for (int k = 0; k < bus->channels.size(); k++) {
-			if (!bus->channels[k].active) {
-				bus->channels.write[k].peak_volume = AudioFrame(AUDIO_MIN_PEAK_DB, AUDIO_MIN_PEAK_DB);
+void AudioServer::_process_bus_task(uint32_t p_index, Bus *const *p_buses) {
+	_process_bus(p_buses[p_index]);
+}
+
+void AudioServer::_process_bus(Bus *p_bus) {
+#ifdef DEBUG_ENABLED
+	uint64_t bus_ticks = OS::get_singleton()->get_ticks_usec();
+#endif
+	// Mix what the buses sending to this one produced, they were processed before it.
+	for (const Bus *source : p_bus->sources) {
+		for (int k = 0; k < source->channels.size(); k++) {
+			if (!source->channels[k].active) {
 				continue;
 			}
 
-			AudioFrame *buf = bus->channels.write[k].buffer.ptrw();
+			Bus::Channel &channel = p_bus->channels.write[k];
+			AudioFrame *target_buf = channel.buffer.ptrw();
+			if (!channel.used) {
+				channel.used = true;
+				channel.active = true;
+				channel.last_mix_with_audio = mix_frames;
+				for (uint32_t j = 0; j < buffer_size; j++) {
+					target_buf[j] = AudioFrame(0, 0);
+				}
+			}
 
-			AudioFrame peak = AudioFrame(0, 0);
+			const AudioFrame *buf = source->channels[k].buffer.ptr();
+			for (uint32_t j = 0; j < buffer_size; j++) {
+				target_buf[j] += buf[j];
+			}
+		}
+	}
 
-			float volume = Math::db_to_linear(bus->volume_db);
+	for (int k = 0; k < p_bus->channels.size(); k++) {
+		if (p_bus->channels[k].active && !p_bus->channels[k].used) {
+			//buffer was not used, but it's still active, so it must be cleaned
+			AudioFrame *buf = p_bus->channels.write[k].buffer.ptrw();
 
-			if (solo_mode) {
-				if (!bus->soloed) {
-					volume = 0.0;
-				}
-			} else {
-				if (bus->mute) {
-					volume = 0.0;
-				}
+			for (uint32_t j = 0; j < buffer_size; j++) {
+				buf[j] = AudioFrame(0, 0);
 			}
+		}
+	}
 
-			//apply volume and compute peak
-			for (uint32_t j = 0; j < buffer_size; j++) {
-				buf[j] *= volume;
+	//process effects
+	if (!p_bus->bypass) {
+		for (int j = 0; j < p_bus->effects.size(); j++) {
+			if (!p_bus->effects[j].enabled) {
+				continue;
+			}
 
-				float l = ABS(buf[j].l);
-				if (l > peak.l) {
-					peak.l = l;
+#ifdef DEBUG_ENABLED
+			uint64_t ticks = OS::get_singleton()->get_ticks_usec();
+#endif
+
+			for (int k = 0; k < p_bus->channels.size(); k++) {
+				if (!(p_bus->channels[k].active || p_bus->channels[k].effect_instances[j]->process_silence())) {
+					continue;
 				}
-				float r = ABS(buf[j].r);
-				if (r > peak.r) {
-					peak.r = r;
+				p_bus->channels.write[k].effect_instances.write[j]->process(p_bus->channels[k].buffer.ptr(), p_bus->channels.write[k].effect_buffer.ptrw(), buffer_size);
+			}
+
+			//swap buffers, so internal buffer always has the right data
+			for (int k = 0; k < p_bus->channels.size(); k++) {
+				if (!(p_bus->channels[k].active || p_bus->channels[k].effect_instances[j]->process_silence())) {
+					continue;
 				}
+				SWAP(p_bus->channels.write[k].buffer, p_bus->channels.write[k].effect_buffer);
 			}
 
-			bus->channels.write[k].peak_volume = AudioFrame(Math::linear_to_db(peak.l + AUDIO_PEAK_OFFSET), Math::linear_to_db(peak.r + AUDIO_PEAK_OFFSET));
+#ifdef DEBUG_ENABLED
+			p_bus->effects.write[j].prof_time += OS::get_singleton()->get_ticks_usec() - ticks;
+#endif
+		}
+	}
+
+	for (int k = 0; k < p_bus->channels.size(); k++) {
+		if (!p_bus->channels[k].active) {
+			p_bus->channels.write[k].peak_volume = AudioFrame(AUDIO_MIN_PEAK_DB, AUDIO_MIN_PEAK_DB);
+			continue;
+		}
 
-			if (!bus->channels[k].used) {
-				//see if any audio is contained, because channel was not used
+		AudioFrame *buf = p_bus->channels.write[k].buffer.ptrw();
 
-				if (MAX(peak.r, peak.l) > Math::db_to_linear(channel_disable_threshold_db)) {
-					bus->channels.write[k].last_mix_with_audio = mix_frames;
-				} else if (mix_frames - bus->channels[k].last_mix_with_audio > channel_disable_frames) {
-					bus->channels.write[k].active = false;
-					continue; //went inactive, don't mix.
-				}
+		AudioFrame peak = AudioFrame(0, 0);
+
+		float volume = Math::db_to_linear(p_bus->volume_db);
+
+		if (mix_solo_mode) {
+			if (!p_bus->soloed) {
+				volume = 0.0;
+			}
+		} else {
+			if (p_bus->mute) {
+				volume = 0.0;
 			}
+		}
+
+		//apply volume and compute peak, without branches so the loop can be vectorized
+		for (uint32_t j = 0; j < buffer_size; j++) {
+			buf[j] *= volume;
+			peak.l = MAX(peak.l, ABS(buf[j].l));
+			peak.r = MAX(peak.r, ABS(buf[j].r));
+		}
 
-			if (send) {
-				//if not master bus, send
-				AudioFrame *target_buf = thread_get_channel_mix_buffer(send->index_cache, k);
+		p_bus->channels.write[k].peak_volume = AudioFrame(Math::linear_to_db(peak.l + AUDIO_PEAK_OFFSET), Math::linear_to_db(peak.r + AUDIO_PEAK_OFFSET));
 
-				for (uint32_t j = 0; j < buffer_size; j++) {
-					target_buf[j] += buf[j];
-				}
+		if (!p_bus->channels[k].used) {
+			//see if any audio is contained, because channel was not used
+
+			if (MAX(peak.r, peak.l) > Math::db_to_linear(channel_disable_threshold_db)) {
+				p_bus->channels.write[k].last_mix_with_audio = mix_frames;
+			} else if (mix_frames - p_bus->channels[k].last_mix_with_audio > channel_disable_frames) {
+				p_bus->channels.write[k].active = false; //went inactive, so it's not sent.
 			}
 		}
 	}
 
-	mix_frames += buffer_size;
-	to_mix = buffer_size;
+#ifdef DEBUG_ENABLED
+	p_bus->prof_time += OS::get_singleton()->get_ticks_usec() - bus_ticks;
+#endif
 }
 
 void AudioServer::_mix_step_for_channel(AudioFrame *p_out_buf, AudioFrame *p_source_buf, AudioFrame p_vol_start, AudioFrame p_vol_final, float p_attenuation_filter_cutoff_hz, float p_highshelf_gain, AudioFilterSW::Processor *p_processor_l, AudioFilterSW::Processor *p_processor_r) {
@@ -645,20 +771,39 @@ void AudioServer::_mix_step_for_channel(AudioFrame *p_out_buf, AudioFrame *p_sou
 		p_processor_r->set_filter(&filter, /* clear_history= */ is_just_started);
 		p_processor_r->update_coeffs(buffer_size);
 
+		// The buffer size is a power of two, so multiplying by its inverse is exact.
+		const float frame_step = 1.0f / buffer_size;
+		// The volume is applied to a chunk first, then both channels of the chunk are filtered together.
+		const unsigned int FILTER_CHUNK_SIZE = 64;
+		AudioFrame mixed[FILTER_CHUNK_SIZE];
+		for (unsigned int chunk_start = 0; chunk_start < buffer_size; chunk_start += FILTER_CHUNK_SIZE) {
+			const unsigned int chunk_size = MIN(FILTER_CHUNK_SIZE, buffer_size - chunk_start);
+			for (unsigned int i = 0; i < chunk_size; i++) {
+				// Make this buffer size invariant if buffer_size ever becomes a project setting.
+				float lerp_param = (chunk_start + i) * frame_step;
+				AudioFrame vol = p_vol_final * lerp_param + (1 - lerp_param) * p_vol_start;
+				mixed[i] = vol * p_source_buf[chunk_start + i];
+			}
+			p_processor_l->process_stereo_interp(p_processor_r, &mixed[0].l, chunk_size);
+			for (unsigned int i = 0; i < chunk_size; i++) {
+				p_out_buf[chunk_start + i] += mixed[i];
+			}
+		}
+
+	} else if (p_vol_start.l == p_vol_final.l && p_vol_start.r == p_vol_final.r) {
+		if (p_vol_final.l == 0 && p_vol_final.r == 0) {
+			return; // Silent, e.g. a playback that already faded out of this bus.
+		}
+		// Without a ramp, the loop is a plain multiply-add that compilers vectorize.
 		for (unsigned int frame_idx = 0; frame_idx < buffer_size; frame_idx++) {
-			// Make this buffer size invariant if buffer_size ever becomes a project setting.
-			float lerp_param = (float)frame_idx / buffer_size;
-			AudioFrame vol = p_vol_final * lerp_param + (1 - lerp_param) * p_vol_start;
-			AudioFrame mixed = vol * p_source_buf[frame_idx];
-			p_processor_l->process_one_interp(mixed.l);
-			p_processor_r->process_one_interp(mixed.r);
-			p_out_buf[frame_idx] += mixed;
+			p_out_buf[frame_idx] += p_vol_final * p_source_buf[frame_idx];
 		}
 
 	} else {
+		const float frame_step = 1.0f / buffer_size;
 		for (unsigned int frame_idx = 0; frame_idx < buffer_size; frame_idx++) {
 			// Make this buffer size invariant if buffer_size ever becomes a project setting.
-			float lerp_param = (float)frame_idx / buffer_size;
+			float lerp_param = frame_idx * frame_step;
 			p_out_buf[frame_idx] += (p_vol_final * lerp_param + (1 - lerp_param) * p_vol_start) * p_source_buf[frame_idx];
 		}
 	}
@@ -755,6 +900,7 @@ void AudioServer::set_bus_count(int p_count) {
 		buses.write[i]->channels.resize(channel_count);
 		for (int j = 0; j < channel_count; j++) {
 			buses.write[i]->channels.write[j].buffer.resize(buffer_size);
+			buses.write[i]->channels.write[j].effect_buffer.resize(buffer_size);
 		}
 		buses[i]->name = attempt;
 		buses[i]->solo = false;
@@ -824,6 +970,7 @@ void AudioServer::add_bus(int p_at_pos) {
 	bus->channels.resize(channel_count);
 	for (int j = 0; j < channel_count; j++) {
 		bus->channels.write[j].buffer.resize(buffer_size);
+		bus->channels.write[j].effect_buffer.resize(buffer_size);
 	}
 	bus->name = attempt;
 	bus->solo = false;
@@ -1348,6 +1495,93 @@ uint64_t AudioServer::get_mixed_frames() const {
 	return mix_frames;
 }
 
+uint32_t AudioServer::get_real_voice_count() const {
+	return real_voice_count.get();
+}
+
+uint32_t AudioServer::get_virtual_voice_count() const {
+	return virtual_voice_count.get();
+}
+
+bool AudioServer::is_decode_ahead_enabled() const {
+	return !decode_ahead_threads.is_empty();
+}
+
+void AudioServer::_register_decode_ahead(AudioStreamPlaybackResampled *p_playback) {
+	MutexLock lock(decode_ahead_mutex);
+	decode_ahead_playbacks.push_back(p_playback);
+}
+
+void AudioServer::_unregister_decode_ahead(AudioStreamPlaybackResampled *p_playback) {
+	// Waits for a decoder thread that is scanning the playbacks, so it can't pick this one up once it's gone.
+	MutexLock lock(decode_ahead_mutex);
+	decode_ahead_playbacks.erase(p_playback);
+}
+
+void AudioServer::_request_decode_ahead() {
+	if (decode_ahead_exit.is_set()) {
+		return;
+	}
+	decode_ahead_semaphore.post();
+}
+
+void AudioServer::_decode_ahead_thread_func(void *p_userdata) {
+	AudioServer *as = static_cast<AudioServer *>(p_userdata);
+
+	while (true) {
+		as->decode_ahead_semaphore.wait();
+		if (as->decode_ahead_exit.is_set()) {
+			break;
+		}
+
+		// Each request posts once, so each wake-up serves one playback.
+		Ref<AudioStreamPlaybackResampled> playback;
+		{
+			MutexLock lock(as->decode_ahead_mutex);
+			const uint32_t count = as->decode_ahead_playbacks.size();
+			for (uint32_t i = 0; i < count; i++) {
+				const uint32_t idx = (as->decode_ahead_next + i) % count;
+				AudioStreamPlaybackResampled *candidate = as->decode_ahead_playbacks[idx];
+				if (!candidate->decode_ahead_requested.exchange(false)) {
+					continue;
+				}
+				// Stays null if the playback is already being freed, it unregisters once this lock is released.
+				playback = Ref<AudioStreamPlaybackResampled>(candidate);
+				if (playback.is_valid()) {
+					as->decode_ahead_next = idx + 1;
+					break;
+				}
+			}
+		}
+		if (playback.is_valid()) {
+			playback->_decode_ahead();
+		}
+	}
+}
+
+void AudioServer::_start_decode_ahead_threads(int p_count) {
+#ifdef THREADS_ENABLED
+	decode_ahead_exit.clear();
+	Thread::Settings settings;
+	settings.priority = Thread::PRIORITY_HIGH;
+	for (int i = 0; i < p_count; i++) {
+		Thread *thread = memnew(Thread);
+		thread->start(_decode_ahead_thread_func, this, settings);
+		decode_ahead_threads.push_back(thread);
+	}
+#endif
+}
+
+void AudioServer::_finish_decode_ahead_threads() {
+	decode_ahead_exit.set();
+	decode_ahead_semaphore.post(decode_ahead_threads.size());
+	for (Thread *thread : decode_ahead_threads) {
+		thread->wait_to_finish();
+		memdelete(thread);
+	}
+	decode_ahead_threads.clear();
+}
+
 void AudioServer::notify_listener_changed() {
 	for (CallbackItem *ci : listener_changed_callback_list) {
 		ci->callback(ci->userdata);
@@ -1356,17 +1590,13 @@ void AudioServer::notify_listener_changed() {
 
 void AudioServer::init_channels_and_buffers() {
 	channel_count = get_channel_count();
-	temp_buffer.resize(channel_count);
 	mix_buffer.resize(buffer_size + LOOKAHEAD_BUFFER_SIZE);
 
-	for (int i = 0; i < temp_buffer.size(); i++) {
-		temp_buffer.write[i].resize(buffer_size);
-	}
-
 	for (int i = 0; i < buses.size(); i++) {
 		buses[i]->channels.resize(channel_count);
 		for (int j = 0; j < channel_count; j++) {
 			buses.write[i]->channels.write[j].buffer.resize(buffer_size);
+			buses.write[i]->channels.write[j].effect_buffer.resize(buffer_size);
 		}
 		_update_bus_effects(i);
 	}
@@ -1376,6 +1606,18 @@ void AudioServer::init() {
 	channel_disable_threshold_db = GLOBAL_DEF_RST("audio/buses/channel_disable_threshold_db", -60.0);
 	channel_disable_frames = float(GLOBAL_DEF_RST(PropertyInfo(Variant::FLOAT, "audio/buses/channel_disable_time", PROPERTY_HINT_RANGE, "0,5,0.01,or_greater"), 2.0)) * get_mix_rate();
 	buffer_size = 512; //hardcoded for now
+	threaded_bus_processing = GLOBAL_DEF_RST("audio/buses/threaded_processing", false);
+	voice_virtualization = GLOBAL_DEF_RST("audio/virtual_voices/enabled", false);
+	virtual_voice_threshold_linear = Math::db_to_linear(float(GLOBAL_DEF_RST(PropertyInfo(Variant::FLOAT, "audio/virtual_voices/audibility_threshold_db", PROPERTY_HINT_RANGE, "-120,0,0.1,suffix:dB"), -60.0)));
+	virtual_voice_hysteresis_linear = Math::db_to_linear(VIRTUAL_VOICE_HYSTERESIS_DB);
+	virtual_voice_hold_frames = VIRTUAL_VOICE_HOLD_TIME * get_mix_rate();
+	max_real_voices = GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "audio/virtual_voices/max_real_voices", PROPERTY_HINT_RANGE, "0,4096,1,or_greater"), 0);
+
+	GLOBAL_DEF_RST("audio/decode_ahead/enabled", false);
+	GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "audio/decode_ahead/max_threads", PROPERTY_HINT_RANGE, "1,16,1"), 2);
+	if (GLOBAL_GET("audio/decode_ahead/enabled")) {
+		_start_decode_ahead_threads(MAX(int(GLOBAL_GET("audio/decode_ahead/max_threads")), 1));
+	}
 
 	init_channels_and_buffers();
 
@@ -1411,6 +1653,19 @@ void AudioServer::update() {
 
 		for (int i = buses.size() - 1; i >= 0; i--) {
 			Bus *bus = buses[i];
+
+			// The bus time includes its effects, mixing and sending.
+			values.push_back(String(bus->name) + " (Bus)");
+			values.push_back(USEC_TO_SEC(bus->prof_time));
+
+			// Subtract the bus time from the driver and server times
+			if (driver_time > bus->prof_time) {
+				driver_time -= bus->prof_time;
+			}
+			if (server_time > bus->prof_time) {
+				server_time -= bus->prof_time;
+			}
+
 			if (bus->bypass) {
 				continue;
 			}
@@ -1422,14 +1677,6 @@ void AudioServer::update() {
 
 				values.push_back(String(bus->name) + bus->effects[j].effect->get_name());
 				values.push_back(USEC_TO_SEC(bus->effects[j].prof_time));
-
-				// Subtract the effect time from the driver and server times
-				if (driver_time > bus->effects[j].prof_time) {
-					driver_time -= bus->effects[j].prof_time;
-				}
-				if (server_time > bus->effects[j].prof_time) {
-					server_time -= bus->effects[j].prof_time;
-				}
 			}
 		}
 
@@ -1445,6 +1692,7 @@ void AudioServer::update() {
 	// Reset profiling times
 	for (int i = buses.size() - 1; i >= 0; i--) {
 		Bus *bus = buses[i];
+		bus->prof_time = 0;
 		if (bus->bypass) {
 			continue;
 		}
@@ -1496,6 +1744,8 @@ void AudioServer::finish() {
 		AudioDriverManager::get_driver(i)->finish();
 	}
 
+	_finish_decode_ahead_threads();
+
 	for (int i = 0; i < buses.size(); i++) {
 		memdelete(buses[i]);
 	}
@@ -1631,6 +1881,7 @@ void AudioServer::set_bus_layout(const Ref<AudioBusLayout> &p_bus_layout) {
 		buses[i]->channels.resize(channel_count);
 		for (int j = 0; j < channel_count; j++) {
 			buses.write[i]->channels.write[j].buffer.resize(buffer_size);
+			buses.write[i]->channels.write[j].effect_buffer.resize(buffer_size);
 		}
 		_update_bus_effects(i);
 	}
@@ -34,6 +34,9 @@
 #include "core/math/audio_frame.h"
 #include "core/object/class_db.h"
 #include "core/os/os.h"
+#include "core/os/semaphore.h"
+#include "core/os/thread.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/safe_list.h"
 #include "core/variant/variant.h"
 #include "servers/audio/audio_effect.h"
@@ -45,6 +48,7 @@ class AudioDriverDummy;
 class AudioStream;
 class AudioStreamWAV;
 class AudioStreamPlayback;
+class AudioStreamPlaybackResampled;
 
 class AudioDriver {
 	static AudioDriver *singleton;
@@ -210,6 +214,7 @@ private:
 			bool active = false;
 			AudioFrame peak_volume = AudioFrame(AUDIO_MIN_PEAK_DB, AUDIO_MIN_PEAK_DB);
 			Vector<AudioFrame> buffer;
+			Vector<AudioFrame> effect_buffer; // Effects write here, then it's swapped with buffer.
 			Vector<Ref<AudioEffectInstance>> effect_instances;
 			uint64_t last_mix_with_audio = 0;
 			Channel() {}
@@ -229,6 +234,13 @@ private:
 		float volume_db = 0.0f;
 		StringName send;
 		int index_cache = 0;
+
+		// Set at the start of each mix.
+		LocalVector<Bus *> sources; // Buses that send to this one.
+		int level = 0; // Longest chain of buses sending to this one.
+#ifdef DEBUG_ENABLED
+		uint64_t prof_time = 0;
+#endif
 	};
 
 	struct AudioStreamPlaybackBusDetails {
@@ -261,6 +273,15 @@ private:
 		AudioStreamPlaybackBusDetails *prev_bus_details = nullptr;
 		// The next few samples are stored here so we have some time to fade audio out if it ends abruptly at the beginning of the next mix.
 		AudioFrame lookahead[LOOKAHEAD_BUFFER_SIZE];
+		// Voice virtualization, only accessed on the audio thread.
+		float loudness = 0.0f; // Highest volume it's sent to any bus with, raised by the hysteresis margin if it's real.
+		bool should_virtualize = false;
+		bool is_virtual = false; // Still mixed so it can end, but not sent to any bus.
+		uint64_t virtual_hold_until_frame = 0; // It doesn't change state again before this.
+	};
+
+	struct PlaybackLoudnessComparator {
+		_FORCE_INLINE_ bool operator()(const AudioStreamPlaybackListNode *p_a, const AudioStreamPlaybackListNode *p_b) const { return p_a->loudness > p_b->loudness; }
 	};
 
 	SafeList<AudioStreamPlaybackListNode *> playback_list;
@@ -269,11 +290,24 @@ private:
 	// TODO document if this is necessary.
 	SafeList<AudioStreamPlaybackBusDetails *> bus_details_graveyard_frame_old;
 
-	Vector<Vector<AudioFrame>> temp_buffer; //temp_buffer for each level
 	Vector<AudioFrame> mix_buffer;
 	Vector<Bus *> buses;
 	HashMap<StringName, Bus *> bus_map;
 
+	bool threaded_bus_processing = false;
+
+	bool voice_virtualization = false;
+	float virtual_voice_threshold_linear = 0.0f;
+	float virtual_voice_hysteresis_linear = 1.0f;
+	uint64_t virtual_voice_hold_frames = 0;
+	int max_real_voices = 0;
+	LocalVector<AudioStreamPlaybackListNode *> voice_candidates;
+	SafeNumeric<uint32_t> real_voice_count;
+	SafeNumeric<uint32_t> virtual_voice_count;
+	bool mix_solo_mode = false;
+	LocalVector<Bus *> bus_schedule; // Buses in processing order, grouped by level.
+	LocalVector<uint32_t> bus_schedule_levels; // Where each level starts in bus_schedule.
+
 	void _update_bus_effects(int p_bus);
 
 	static AudioServer *singleton;
@@ -281,6 +315,9 @@ private:
 	void init_channels_and_buffers();
 
 	void _mix_step();
+	void _update_virtual_voices();
+	void _process_bus(Bus *p_bus);
+	void _process_bus_task(uint32_t p_index, Bus *const *p_buses);
 	void _mix_step_for_channel(AudioFrame *p_out_buf, AudioFrame *p_source_buf, AudioFrame p_vol_start, AudioFrame p_vol_final, float p_attenuation_filter_cutoff_hz, float p_highshelf_gain, AudioFilterSW::Processor *p_processor_l, AudioFilterSW::Processor *p_processor_r);
 
 	// Should only be called on the main thread.
@@ -295,9 +332,29 @@ private:
 	SafeList<CallbackItem *> mix_callback_list;
 	SafeList<CallbackItem *> listener_changed_callback_list;
 
+	// Decoder threads shared by all the playbacks decoding ahead of the mix.
+	LocalVector<Thread *> decode_ahead_threads;
+	Mutex decode_ahead_mutex;
+	Semaphore decode_ahead_semaphore;
+	SafeFlag decode_ahead_exit;
+	// Playbacks that decode ahead, scanned by the decoder threads for refill requests. Guarded by decode_ahead_mutex.
+	LocalVector<AudioStreamPlaybackResampled *> decode_ahead_playbacks;
+	uint32_t decode_ahead_next = 0; // Where the next scan starts, so every playback gets its turn.
+
+	static void _decode_ahead_thread_func(void *p_userdata);
+	void _start_decode_ahead_threads(int p_count);
+	void _finish_decode_ahead_threads();
+
+	friend class AudioStreamPlaybackResampled;
+	void _register_decode_ahead(AudioStreamPlaybackResampled *p_playback);
+	void _unregister_decode_ahead(AudioStreamPlaybackResampled *p_playback);
+	void _request_decode_ahead(); // Called on the audio thread, doesn't allocate.
+
 	friend class AudioDriver;
 	void _driver_process(int p_frames, int32_t *p_buffer);
 
+	friend class TestAudioServerInternalsAccessor;
+
 protected:
 	static void _bind_methods();
 
@@ -391,6 +448,11 @@ public:
 	uint64_t get_mix_count() const;
 	uint64_t get_mixed_frames() const;
 
+	uint32_t get_real_voice_count() const;
+	uint32_t get_virtual_voice_count() const;
+
+	bool is_decode_ahead_enabled() const;
+
 	void notify_listener_changed();
 
 	virtual void init();
@@ -93,3 +93,44 @@ Vector<float> MeshStorage::multimesh_get_buffer(RID p_multimesh) const {
 
 	return multimesh->buffer;
 }
+
+RID MeshStorage::skeleton_allocate() {
+	return skeleton_owner.allocate_rid();
+}
+
+void MeshStorage::skeleton_initialize(RID p_rid) {
+	skeleton_owner.initialize_rid(p_rid, DummySkeleton());
+}
+
+void MeshStorage::skeleton_free(RID p_rid) {
+	DummySkeleton *skeleton = skeleton_owner.get_or_null(p_rid);
+	ERR_FAIL_NULL(skeleton);
+
+	skeleton_owner.free(p_rid);
+}
+
+void MeshStorage::skeleton_allocate_data(RID p_skeleton, int p_bones, bool p_2d_skeleton) {
+	DummySkeleton *skeleton = skeleton_owner.get_or_null(p_skeleton);
+	ERR_FAIL_NULL(skeleton);
+	skeleton->bones.resize(p_bones);
+}
+
+int MeshStorage::skeleton_get_bone_count(RID p_skeleton) const {
+	DummySkeleton *skeleton = skeleton_owner.get_or_null(p_skeleton);
+	ERR_FAIL_NULL_V(skeleton, 0);
+	return skeleton->bones.size();
+}
+
+void MeshStorage::skeleton_bone_set_transform(RID p_skeleton, int p_bone, const Transform3D &p_transform) {
+	DummySkeleton *skeleton = skeleton_owner.get_or_null(p_skeleton);
+	ERR_FAIL_NULL(skeleton);
+	ERR_FAIL_INDEX(p_bone, (int)skeleton->bones.size());
+	skeleton->bones[p_bone] = p_transform;
+}
+
+Transform3D MeshStorage::skeleton_bone_get_transform(RID p_skeleton, int p_bone) const {
+	DummySkeleton *skeleton = skeleton_owner.get_or_null(p_skeleton);
+	ERR_FAIL_NULL_V(skeleton, Transform3D());
+	ERR_FAIL_INDEX_V(p_bone, (int)skeleton->bones.size(), Transform3D());
+	return skeleton->bones[p_bone];
+}
@@ -63,6 +63,9 @@ public:
 		} else if (RendererDummy::MeshStorage::get_singleton()->owns_mesh(p_rid)) {
 			RendererDummy::MeshStorage::get_singleton()->mesh_free(p_rid);
 			return true;
+		} else if (RendererDummy::MeshStorage::get_singleton()->owns_skeleton(p_rid)) {
+			RendererDummy::MeshStorage::get_singleton()->skeleton_free(p_rid);
+			return true;
 		}
 		return false;
 	}
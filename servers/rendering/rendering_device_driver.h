@@ -80,6 +80,8 @@ public:
 			_ptr(p_ptr), _size(p_size) {}
 	VectorView(const Vector<T> &p_lv) :
 			_ptr(p_lv.ptr()), _size(p_lv.size()) {}
+	VectorView(const VectorSlice<T> &p_slice) :
+			_ptr(p_slice.ptr()), _size(p_slice.size()) {}
 	VectorView(const LocalVector<T> &p_lv) :
 			_ptr(p_lv.ptr()), _size(p_lv.size()) {}
 };
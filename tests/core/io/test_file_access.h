@@ -32,9 +32,22 @@
 #define TEST_FILE_ACCESS_H
 
 #include "core/io/file_access.h"
+#include "core/io/file_access_compressed.h"
+#include "core/os/os.h"
 #include "tests/test_macros.h"
 #include "tests/test_utils.h"
 
+class TestFileAccessCompressedInternalsAccessor {
+public:
+	static bool is_reading_ahead(const FileAccessCompressed *p_file) {
+		return p_file->read_ahead_task != WorkerThreadPool::INVALID_TASK_ID;
+	}
+
+	static uint32_t get_read_ahead_first_block(const FileAccessCompressed *p_file) {
+		return p_file->read_ahead.first_block;
+	}
+};
+
 namespace TestFileAccess {
 
 TEST_CASE("[FileAccess] CSV read") {
@@ -107,6 +120,94 @@ TEST_CASE("[FileAccess] Get as UTF-8 String") {
 	CHECK(s_cr == "Hello darkness\rMy old friend\rI've come to talk\rWith you again\r");
 	CHECK(s_cr_nocr == "Hello darknessMy old friendI've come to talkWith you again");
 }
+
+TEST_CASE("[FileAccess] Compressed read and write") {
+	const String file_path = OS::get_singleton()->get_cache_path().path_join("compressed.bin");
+
+	// Multiple blocks, with a partial last block.
+	Vector<uint8_t> data;
+	data.resize(4096 * 40 + 123);
+	for (int i = 0; i < data.size(); i++) {
+		data.write[i] = (i * 7 + i / 1000) % 251;
+	}
+
+	{
+		Ref<FileAccess> f = FileAccess::open_compressed(file_path, FileAccess::WRITE, FileAccess::COMPRESSION_ZSTD);
+		REQUIRE(f.is_valid());
+		f->store_buffer(data.ptr(), data.size());
+	}
+
+	Ref<FileAccess> f = FileAccess::open_compressed(file_path, FileAccess::READ, FileAccess::COMPRESSION_ZSTD);
+	REQUIRE(f.is_valid());
+	CHECK(f->get_length() == uint64_t(data.size()));
+
+	// Sequential reads, in chunks that don't match the block size.
+	Vector<uint8_t> read_data;
+	read_data.resize(data.size());
+	uint64_t read = 0;
+	while (read < uint64_t(data.size())) {
+		const uint64_t chunk_read = f->get_buffer(read_data.ptrw() + read, MIN(uint64_t(1000), data.size() - read));
+		if (chunk_read == 0) {
+			break;
+		}
+		read += chunk_read;
+	}
+	REQUIRE_MESSAGE(read == uint64_t(data.size()), "Sequential reads should return the whole file.");
+	CHECK(read_data == data);
+	CHECK(f->get_position() == uint64_t(data.size()));
+	CHECK(f->get_buffer(1).is_empty());
+	CHECK(f->eof_reached());
+
+	// Random access, both into cached and evicted blocks.
+	const uint64_t offsets[] = { 5, 4096 * 39 + 100, 4096 * 3 - 1, 4096 * 20, 0, uint64_t(data.size() - 1) };
+	for (uint64_t offset : offsets) {
+		f->seek(offset);
+		CHECK(f->get_position() == offset);
+		CHECK(f->get_8() == data[offset]);
+	}
+}
+
+TEST_CASE("[FileAccess] Compressed read-ahead restarts after seeking away from it") {
+	const String file_path = OS::get_singleton()->get_cache_path().path_join("compressed_read_ahead.bin");
+	const uint64_t block_size = 4096;
+
+	Vector<uint8_t> data;
+	data.resize(block_size * 40 + 123);
+	for (int i = 0; i < data.size(); i++) {
+		data.write[i] = (i * 7 + i / 1000) % 251;
+	}
+
+	{
+		Ref<FileAccess> f = FileAccess::open_compressed(file_path, FileAccess::WRITE, FileAccess::COMPRESSION_ZSTD);
+		REQUIRE(f.is_valid());
+		f->store_buffer(data.ptr(), data.size());
+	}
+
+	Ref<FileAccess> f = FileAccess::open_compressed(file_path, FileAccess::READ, FileAccess::COMPRESSION_ZSTD);
+	REQUIRE(f.is_valid());
+	const FileAccessCompressed *fac = Object::cast_to<FileAccessCompressed>(f.ptr());
+	REQUIRE(fac);
+	if (!TestFileAccessCompressedInternalsAccessor::is_reading_ahead(fac)) {
+		// No worker threads to read ahead with.
+		return;
+	}
+	// Opening reads the first block and the blocks after it ahead.
+	CHECK(TestFileAccessCompressedInternalsAccessor::get_read_ahead_first_block(fac) == 1);
+
+	// Seek past the blocks read ahead, then read sequentially into the next block.
+	const uint64_t offset = block_size * 30 + block_size / 2;
+	f->seek(offset);
+	Vector<uint8_t> read_data = f->get_buffer(block_size);
+	CHECK(read_data == data.slice(offset, offset + block_size));
+
+	CHECK(TestFileAccessCompressedInternalsAccessor::is_reading_ahead(fac));
+	CHECK(TestFileAccessCompressedInternalsAccessor::get_read_ahead_first_block(fac) == 32);
+
+	// The blocks read ahead are the right ones.
+	f->seek(block_size * 32);
+	read_data = f->get_buffer(block_size * 8);
+	CHECK(read_data == data.slice(block_size * 32, block_size * 40));
+}
 } // namespace TestFileAccess
 
 #endif // TEST_FILE_ACCESS_H
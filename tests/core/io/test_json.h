@@ -232,6 +232,63 @@ TEST_CASE("[JSON] Parsing escape sequences") {
 		ERR_PRINT_ON
 	}
 }
+
+TEST_CASE("[JSON] Parsing UTF-8 buffers") {
+	JSON json;
+
+	const String text = String::utf8("{\"name\": \"G\u00f6dot \\u00e9 engine with a long enough string\", \"list\": [1, -2.5e1, true, null, \"\u3053\u3093\u306b\u3061\u306f\"]}");
+	REQUIRE(json.parse(text) == OK);
+	const Variant from_string = json.get_data();
+
+	REQUIRE(json.parse_utf8(text.to_utf8_buffer()) == OK);
+	CHECK_MESSAGE(json.get_data() == from_string, "Parsing UTF-8 bytes should give the same result as parsing the decoded string.");
+
+	Dictionary dict = json.get_data();
+	CHECK(String(dict["name"]) == String::utf8("G\u00f6dot \u00e9 engine with a long enough string"));
+	CHECK(Array(dict["list"]).size() == 5);
+	CHECK(String(Array(dict["list"])[4]) == String::utf8("\u3053\u3093\u306b\u3061\u306f"));
+
+	// Byte order mark and trailing null terminator.
+	PackedByteArray with_bom;
+	with_bom.push_back(0xEF);
+	with_bom.push_back(0xBB);
+	with_bom.push_back(0xBF);
+	with_bom.append_array(String("[\"a\"]").to_utf8_buffer());
+	with_bom.push_back(0);
+	REQUIRE(json.parse_utf8(with_bom) == OK);
+	CHECK(Array(json.get_data()).size() == 1);
+	CHECK(String(Array(json.get_data())[0]) == "a");
+
+	ERR_PRINT_OFF
+	CHECK(json.parse_utf8(String("[\"unterminated string that spans\nmore than one line]").to_utf8_buffer()) == ERR_PARSE_ERROR);
+	CHECK(json.get_error_line() == 1);
+	CHECK(json.parse_utf8(PackedByteArray()) == ERR_PARSE_ERROR);
+	ERR_PRINT_ON
+}
+
+TEST_CASE("[JSON] Stringify") {
+	Array array;
+	array.push_back(1);
+	array.push_back(2.5);
+	array.push_back("text");
+	Dictionary dict;
+	dict["b"] = array;
+	dict["a"] = Dictionary();
+	dict["c"] = Variant();
+
+	CHECK(JSON::stringify(dict) == "{\"a\":{},\"b\":[1,2.5,\"text\"],\"c\":null}");
+	CHECK(JSON::stringify(dict, "", false) == "{\"b\":[1,2.5,\"text\"],\"a\":{},\"c\":null}");
+	Array nested;
+	nested.push_back(1);
+	nested.push_back(Array());
+	CHECK(JSON::stringify(nested, "\t") == "[\n\t1,\n\t[]\n]");
+
+	Array circular;
+	circular.push_back(circular);
+	ERR_PRINT_OFF
+	CHECK(JSON::stringify(circular) == "[\"[...]\"]");
+	ERR_PRINT_ON
+}
 } // namespace TestJSON
 
 #endif // TEST_JSON_H
@@ -326,6 +326,52 @@ TEST_CASE("[Marshalls] FLOAT double precision Variant decoding") {
 	CHECK(r_len == 12);
 	CHECK(variant == Variant(0.33333333333333333));
 }
+
+static Variant _make_nested_variant() {
+	Dictionary inner;
+	inner["name"] = "Godot";
+	inner[StringName("id")] = int64_t(1234567890123);
+	inner[Vector3(1, 2, 3)] = PackedStringArray({ "a", "bc", "def", "ghij" });
+
+	Array array;
+	array.push_back(inner);
+	array.push_back(NodePath("/root/Node:position:x"));
+	array.push_back(PackedByteArray({ 1, 2, 3 }));
+	array.push_back(PackedVector2Array({ Vector2(1, 2), Vector2(3, 4) }));
+	array.push_back(Array());
+	array.push_back(Color(0.5, 0.25, 1));
+	array.push_back(Variant());
+
+	Dictionary root;
+	root["array"] = array;
+	root[0.5] = String::utf8("ünïcödé");
+	return root;
+}
+
+TEST_CASE("[Marshalls] Single pass Variant encoding") {
+	const Variant variant = _make_nested_variant();
+
+	int len;
+	REQUIRE(encode_variant(variant, nullptr, len) == OK);
+	Vector<uint8_t> two_pass;
+	two_pass.resize(len);
+	REQUIRE(encode_variant(variant, two_pass.ptrw(), len) == OK);
+
+	Vector<uint8_t> single_pass;
+	CHECK(encode_variant(variant, single_pass) == OK);
+	CHECK_MESSAGE(single_pass == two_pass, "Single pass encoding should be identical to two pass encoding.");
+
+	// Encoding appends to the existing data.
+	CHECK(encode_variant(variant, single_pass) == OK);
+	CHECK(single_pass.size() == len * 2);
+
+	Variant decoded;
+	int r_len;
+	CHECK(decode_variant(decoded, single_pass.ptr() + len, len, &r_len) == OK);
+	CHECK(r_len == len);
+	CHECK(decoded == variant);
+}
+
 } // namespace TestMarshalls
 
 #endif // TEST_MARSHALLS_H
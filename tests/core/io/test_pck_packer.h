@@ -38,6 +38,13 @@
 #include "tests/test_utils.h"
 #include "thirdparty/doctest/doctest.h"
 
+class TestPackedDataInternalsAccessor {
+public:
+	static void set_singleton(PackedData *p_singleton) {
+		PackedData::singleton = p_singleton;
+	}
+};
+
 namespace TestPCKPacker {
 
 TEST_CASE("[PCKPacker] Pack an empty PCK file") {
@@ -117,6 +124,80 @@ TEST_CASE("[PCKPacker] Pack a PCK file with some files and directories") {
 			f->get_length() <= 27000,
 			"The generated non-empty PCK file shouldn't be too large.");
 }
+
+TEST_CASE("[PCKPacker] Pack and read back compressed files") {
+	// Large enough to span several compressed blocks, with a partial last block.
+	const String source_path = OS::get_singleton()->get_cache_path().path_join("pck_packer_compressed_source.txt");
+	Vector<uint8_t> source_data;
+	source_data.resize(PACK_COMPRESSED_BLOCK_SIZE * 3 + 1234);
+	for (int i = 0; i < source_data.size(); i++) {
+		source_data.write[i] = 'a' + (i % 7) + ((i / 4096) % 3);
+	}
+	{
+		Ref<FileAccess> f = FileAccess::open(source_path, FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		f->store_buffer(source_data.ptr(), source_data.size());
+	}
+
+	PCKPacker pck_packer;
+	const String output_pck_path = OS::get_singleton()->get_cache_path().path_join("output_compressed.pck");
+	REQUIRE(pck_packer.pck_start(output_pck_path) == OK);
+	CHECK_MESSAGE(
+			pck_packer.add_file("res://pck_packer_compressed/data.txt", source_path, false, true) == OK,
+			"Adding a compressed file to the PCK should return an OK error code.");
+	CHECK_MESSAGE(
+			pck_packer.add_file("res://pck_packer_compressed/data_uncompressed.txt", source_path) == OK,
+			"Adding an uncompressed file next to a compressed one should return an OK error code.");
+	CHECK_MESSAGE(
+			pck_packer.flush() == OK,
+			"Flushing the PCK should return an OK error code.");
+
+	Ref<FileAccess> pck = FileAccess::open(output_pck_path, FileAccess::READ);
+	REQUIRE(pck.is_valid());
+	CHECK_MESSAGE(
+			pck->get_length() < uint64_t(source_data.size() + source_data.size() / 2),
+			"The compressed file should take less space than the uncompressed one.");
+	pck.unref();
+
+	// Use a temporary PackedData, so the pack's files aren't visible to other tests, even if a check fails.
+	// Creating it makes it the singleton, so the previous one is restored afterwards.
+	struct ScopedPackedData {
+		PackedData *previous_packed_data = PackedData::get_singleton();
+		PackedData *packed_data = memnew(PackedData);
+		~ScopedPackedData() {
+			memdelete(packed_data);
+			TestPackedDataInternalsAccessor::set_singleton(previous_packed_data);
+		}
+	};
+
+	{
+		ScopedPackedData scoped_packed_data;
+		REQUIRE(scoped_packed_data.packed_data->add_pack(output_pck_path, false, 0) == OK);
+
+		for (const String &path : { String("res://pck_packer_compressed/data.txt"), String("res://pck_packer_compressed/data_uncompressed.txt") }) {
+			Ref<FileAccess> f = FileAccess::open(path, FileAccess::READ);
+			REQUIRE(f.is_valid());
+			CHECK(f->get_length() == uint64_t(source_data.size()));
+
+			Vector<uint8_t> read_data = f->get_buffer(source_data.size());
+			CHECK_MESSAGE(read_data == source_data, "Reading the whole file should return the original data.");
+			CHECK(f->get_buffer(1).is_empty());
+			CHECK(f->eof_reached());
+
+			// Random access, across a block boundary.
+			const uint64_t offset = PACK_COMPRESSED_BLOCK_SIZE * 2 - 10;
+			f->seek(offset);
+			CHECK(f->get_8() == source_data[offset]);
+			Vector<uint8_t> chunk = f->get_buffer(20);
+			CHECK(chunk == source_data.slice(offset + 1, offset + 21));
+
+			f->seek(5);
+			CHECK(f->get_8() == source_data[5]);
+		}
+	}
+
+	CHECK_FALSE(FileAccess::exists("res://pck_packer_compressed/data.txt"));
+}
 } // namespace TestPCKPacker
 
 #endif // TEST_PCK_PACKER_H
@@ -31,6 +31,7 @@
 #ifndef TEST_METHOD_BIND_H
 #define TEST_METHOD_BIND_H
 
+#include "core/extension/gdextension.h"
 #include "core/object/class_db.h"
 
 #include "tests/test_macros.h"
@@ -170,6 +171,73 @@ TEST_CASE("[MethodBind] check all method binds") {
 
 	memdelete(mbt);
 }
+
+TEST_CASE("[MethodBind] Batched ptrcall through the GDExtension interface") {
+	GDExtensionInterfaceObjectMethodBindPtrcallBatch ptrcall_batch = (GDExtensionInterfaceObjectMethodBindPtrcallBatch)GDExtension::get_interface_function("object_method_bind_ptrcall_batch");
+	REQUIRE(ptrcall_batch != nullptr);
+
+	const int count = 4;
+	MethodBindTester *testers[count];
+	GDExtensionObjectPtr instances[count];
+	for (int i = 0; i < count; i++) {
+		testers[i] = memnew(MethodBindTester);
+		testers[i]->test_num = i + 10;
+		instances[i] = testers[i];
+	}
+
+	SUBCASE("Each instance gets its own arguments and return value") {
+		MethodBind *method = ClassDB::get_method("MethodBindTester", "test_methodr_args");
+		REQUIRE(method != nullptr);
+
+		int64_t args[count];
+		int64_t rets[count];
+		GDExtensionConstTypePtr arg_ptrs[count];
+		const GDExtensionConstTypePtr *arg_lists[count];
+		GDExtensionTypePtr ret_ptrs[count];
+		for (int i = 0; i < count; i++) {
+			args[i] = i * 3;
+			rets[i] = -1;
+			arg_ptrs[i] = &args[i];
+			arg_lists[i] = &arg_ptrs[i];
+			ret_ptrs[i] = &rets[i];
+		}
+
+		ptrcall_batch(method, instances, arg_lists, ret_ptrs, count);
+		for (int i = 0; i < count; i++) {
+			CHECK(rets[i] == i * 3);
+		}
+	}
+
+	SUBCASE("Arguments can be shared and return values omitted") {
+		MethodBind *method = ClassDB::get_method("MethodBindTester", "test_method_args");
+		REQUIRE(method != nullptr);
+
+		int64_t arg = 12;
+		GDExtensionConstTypePtr arg_ptr = &arg;
+		const GDExtensionConstTypePtr *arg_lists[count];
+		for (int i = 0; i < count; i++) {
+			testers[i]->test_valid[MethodBindTester::TEST_METHOD_ARGS] = false;
+			arg_lists[i] = &arg_ptr;
+		}
+
+		ptrcall_batch(method, instances, arg_lists, nullptr, count);
+		for (int i = 0; i < count; i++) {
+			// The method checks that the argument matches the tester's number.
+			CHECK(testers[i]->test_valid[MethodBindTester::TEST_METHOD_ARGS] == (i + 10 == 12));
+		}
+
+		ERR_PRINT_OFF
+		MethodBind *returning = ClassDB::get_method("MethodBindTester", "test_methodr");
+		testers[0]->test_valid[MethodBindTester::TEST_METHODR] = false;
+		ptrcall_batch(returning, instances, arg_lists, nullptr, count);
+		CHECK_MESSAGE(!testers[0]->test_valid[MethodBindTester::TEST_METHODR], "Methods returning a value should not be called without return value pointers.");
+		ERR_PRINT_ON
+	}
+
+	for (int i = 0; i < count; i++) {
+		memdelete(testers[i]);
+	}
+}
 } // namespace TestMethodBind
 
 #endif // TEST_METHOD_BIND_H
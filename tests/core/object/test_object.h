@@ -424,6 +424,60 @@ TEST_CASE("[Object] Signals") {
 		object.get_all_signal_connections(&signal_connections);
 		CHECK(signal_connections.size() == 0);
 	}
+
+	SUBCASE("Emitting a signal connected to bound methods should call them with and without argument conversion") {
+		Object target;
+		object.add_user_signal(MethodInfo("meta_signal", PropertyInfo(Variant::STRING_NAME, "name"), PropertyInfo(Variant::INT, "value")));
+		object.connect("meta_signal", Callable(&target, "set_meta"));
+
+		// Arguments of the exact types.
+		Error err = object.emit_signal("meta_signal", StringName("exact"), 1);
+		CHECK(err == OK);
+		CHECK(target.get_meta("exact") == Variant(1));
+
+		// Arguments that must be converted.
+		err = object.emit_signal("meta_signal", String("converted"), 2);
+		CHECK(err == OK);
+		CHECK(target.get_meta("converted") == Variant(2));
+
+		// Too few arguments.
+		ERR_PRINT_OFF;
+		err = object.emit_signal("meta_signal", StringName("missing"));
+		ERR_PRINT_ON;
+		CHECK(err == ERR_METHOD_NOT_FOUND);
+		CHECK_FALSE(target.has_meta("missing"));
+	}
+
+	SUBCASE("Connecting and disconnecting while emitting should only affect later emissions") {
+		Object first;
+		Object second;
+		object.connect("my_custom_signal", Callable(&first, "set_meta").bind(1).bind("called"));
+		object.connect("my_custom_signal", callable_mp(&object, &Object::disconnect).bind(Callable(&first, "set_meta")).bind("my_custom_signal"), Object::CONNECT_ONE_SHOT);
+		object.connect("my_custom_signal", callable_mp((Object *)&object, &Object::connect).bind(0).bind(Callable(&second, "set_meta").bind(1).bind("called")).bind("my_custom_signal"), Object::CONNECT_ONE_SHOT);
+
+		object.emit_signal("my_custom_signal");
+		CHECK_FALSE(second.has_meta("called"));
+
+		first.remove_meta("called");
+		object.emit_signal("my_custom_signal");
+		CHECK_FALSE(first.has_meta("called"));
+		CHECK(second.has_meta("called"));
+	}
+
+	SUBCASE("Disconnecting should release the callable even if the signal isn't emitted again") {
+		Object target;
+		Ref<RefCounted> bound;
+		bound.instantiate();
+		Callable callable = Callable(&target, "set_meta").bind(bound).bind("bound");
+		object.connect("my_custom_signal", callable);
+		object.emit_signal("my_custom_signal");
+		CHECK(target.get_meta("bound") == Variant(bound));
+		target.remove_meta("bound");
+
+		object.disconnect("my_custom_signal", callable);
+		callable = Callable();
+		CHECK(bound->get_reference_count() == 1);
+	}
 }
 
 class NotificationObject1 : public Object {
@@ -494,6 +548,50 @@ TEST_CASE("[Object] Notification order") { // GH-52325
 	memdelete(test_notification_object);
 }
 
+// Only used by the inherited members test, which adds members to them.
+class InheritedMembersObject1 : public Object {
+	GDCLASS(InheritedMembersObject1, Object);
+};
+
+class InheritedMembersObject2 : public InheritedMembersObject1 {
+	GDCLASS(InheritedMembersObject2, InheritedMembersObject1);
+};
+
+TEST_CASE("[Object] Inherited members") {
+	GDREGISTER_CLASS(_TestDerivedObject);
+	GDREGISTER_CLASS(InheritedMembersObject1);
+	GDREGISTER_CLASS(InheritedMembersObject2);
+
+	SUBCASE("Members of ancestors are found") {
+		_TestDerivedObject derived_object;
+
+		CHECK(ClassDB::get_method("_TestDerivedObject", "get_property") != nullptr);
+		CHECK(ClassDB::get_method("_TestDerivedObject", "get_instance_id") == ClassDB::get_method("Object", "get_instance_id"));
+		CHECK(ClassDB::get_method("_TestDerivedObject", "absent_method") == nullptr);
+
+		bool valid = false;
+		CHECK(ClassDB::get_property_type("_TestDerivedObject", "property", &valid) == Variant::INT);
+		CHECK(valid);
+
+		CHECK(derived_object.get("get_instance_id").get_type() == Variant::CALLABLE);
+		CHECK(derived_object.get("script_changed").get_type() == Variant::SIGNAL);
+		CHECK(derived_object.get("NOTIFICATION_PREDELETE") == Variant(Object::NOTIFICATION_PREDELETE));
+	}
+
+	SUBCASE("Members added to an ancestor after a lookup are found") {
+		InheritedMembersObject2 object;
+
+		bool valid = true;
+		object.get("TEST_INHERITED_CONSTANT", &valid);
+		CHECK_FALSE(valid);
+
+		ClassDB::bind_integer_constant("InheritedMembersObject1", "", "TEST_INHERITED_CONSTANT", 42);
+
+		CHECK(object.get("TEST_INHERITED_CONSTANT", &valid) == Variant(42));
+		CHECK(valid);
+	}
+}
+
 } // namespace TestObject
 
 #endif // TEST_OBJECT_H
@@ -166,6 +166,34 @@ TEST_CASE("[String] UTF8 with CR") {
 	CHECK(no_cr == base.replace("\r", ""));
 }
 
+TEST_CASE("[String] UTF8 with long ASCII runs") {
+	// Long enough for ASCII to be processed several bytes at a time, with other characters at varying offsets.
+	const String base = U"The quick brown fox jumps over the lazy dog. Ünïcödé in the middle\r\nof a 長い line, and at the end: 🦊";
+
+	for (int i = 0; i < 16; i++) {
+		const String s = base.substr(i);
+		const CharString utf8 = s.utf8();
+
+		String decoded;
+		CHECK(decoded.parse_utf8(utf8.get_data(), utf8.length()) == OK);
+		CHECK(decoded == s);
+
+		String decoded_null_terminated;
+		CHECK(decoded_null_terminated.parse_utf8(utf8.get_data()) == OK);
+		CHECK(decoded_null_terminated == s);
+
+		String no_cr;
+		CHECK(no_cr.parse_utf8(utf8.get_data(), utf8.length(), true) == OK);
+		CHECK(no_cr == s.replace("\r", ""));
+	}
+
+	// Data is only read up to a NUL character.
+	const char with_nul[] = "0123456789\0abcdefghijklmnop";
+	String truncated;
+	CHECK(truncated.parse_utf8(with_nul, sizeof(with_nul) - 1) == OK);
+	CHECK(truncated == "0123456789");
+}
+
 TEST_CASE("[String] Invalid UTF8 (non-standard)") {
 	ERR_PRINT_OFF
 	static const uint8_t u8str[] = { 0x45, 0xE3, 0x81, 0x8A, 0xE3, 0x82, 0x88, 0xE3, 0x81, 0x86, 0xF0, 0x9F, 0x8E, 0xA4, 0xF0, 0x82, 0x82, 0xAC, 0xED, 0xA0, 0x81, 0 };
@@ -364,6 +392,27 @@ TEST_CASE("[String] Find no case") {
 	CHECK(s.rfindn("WHA") == 13);
 }
 
+TEST_CASE("[String] Find in long strings") {
+	const String s = U"Lorem ipsum dolor sit amet, consectetur adipiscing elit. LOREM IPSUM ÄÖÜ äöü lorem";
+	CHECK(s.find("Lorem") == 0);
+	CHECK(s.find("Lorem", 1) == -1);
+	CHECK(s.find("elit.") == 51);
+	CHECK(s.find(U"äöü") == 73);
+	CHECK(s.find("lorem ipsum") == -1);
+	CHECK(s.rfind("or") == 78);
+	CHECK(s.rfind("or", 77) == 15);
+	CHECK(s.rfind("Lorem") == 0);
+	CHECK(s.findn("lorem ipsum") == 0);
+	CHECK(s.findn("lorem ipsum", 1) == 57);
+	CHECK(s.findn(U"ÄÖÜ ÄÖÜ") == 69);
+	CHECK(s.rfindn("LOREM") == 77);
+	CHECK(s.rfindn("lorem", 76) == 57);
+	CHECK(s.countn("lorem") == 3);
+	CHECK(s.count("or") == 3);
+	CHECK(s.nocasecmp_to(s.to_upper()) == 0);
+	CHECK(s.nocasecmp_to(s.to_lower() + "a") < 0);
+}
+
 TEST_CASE("[String] Find MK") {
 	Vector<String> keys;
 	keys.push_back("sty");
@@ -0,0 +1,180 @@
+/**************************************************************************/
+/*  test_chunked_hash_map.h                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_CHUNKED_HASH_MAP_H
+#define TEST_CHUNKED_HASH_MAP_H
+
+#include "core/templates/chunked_hash_map.h"
+
+#include "tests/test_macros.h"
+
+namespace TestChunkedHashMap {
+
+TEST_CASE("[ChunkedHashMap] Insert element") {
+	ChunkedHashMap<int, int> map;
+	ChunkedHashMap<int, int>::Iterator e = map.insert(42, 84);
+
+	CHECK(e);
+	CHECK(e->key == 42);
+	CHECK(e->value == 84);
+	CHECK(map[42] == 84);
+	CHECK(map.has(42));
+	CHECK(map.find(42));
+}
+
+TEST_CASE("[ChunkedHashMap] Overwrite element") {
+	ChunkedHashMap<int, int> map;
+	map.insert(42, 84);
+	map.insert(42, 1234);
+
+	CHECK(map[42] == 1234);
+	CHECK(map.size() == 1);
+}
+
+TEST_CASE("[ChunkedHashMap] Erase") {
+	ChunkedHashMap<int, int> map;
+	ChunkedHashMap<int, int>::Iterator e = map.insert(42, 84);
+	map.insert(1, 2);
+	map.remove(e);
+	CHECK(!map.has(42));
+	CHECK(!map.find(42));
+	CHECK(map.has(1));
+
+	CHECK(map.erase(1));
+	CHECK_FALSE(map.erase(1));
+	CHECK(map.is_empty());
+}
+
+TEST_CASE("[ChunkedHashMap] Many elements") {
+	// Enough elements to use the index and several chunks.
+	const int count = 1000;
+	ChunkedHashMap<int, int> map;
+	for (int i = 0; i < count; i++) {
+		map.insert(i, i * 2);
+	}
+	CHECK(map.size() == count);
+
+	for (int i = 0; i < count; i++) {
+		const int *value = map.getptr(i);
+		REQUIRE(value);
+		CHECK(*value == i * 2);
+		CHECK(map.find_at_index(i)->key == i);
+	}
+	CHECK(!map.has(count));
+
+	// Erase every third element, the others must still be found.
+	for (int i = 0; i < count; i += 3) {
+		CHECK(map.erase(i));
+	}
+	for (int i = 0; i < count; i++) {
+		CHECK(map.has(i) == (i % 3 != 0));
+	}
+
+	int idx = 0;
+	for (const KeyValue<int, int> &E : map) {
+		if (idx % 3 == 0) {
+			idx++;
+		}
+		CHECK(E.key == idx);
+		idx++;
+	}
+	CHECK(map.find_at_index(map.size() - 1)->key == count - 1);
+
+	map.clear();
+	CHECK(map.is_empty());
+	CHECK(!map.has(1));
+}
+
+TEST_CASE("[ChunkedHashMap] Insertion order with reused elements") {
+	ChunkedHashMap<int, int> map;
+	for (int i = 0; i < 20; i++) {
+		map.insert(i, i);
+	}
+	for (int i = 0; i < 20; i += 2) {
+		map.erase(i);
+	}
+	// These reuse the memory of erased elements but still come last.
+	map.insert(100, 0);
+	map.insert(0, 0);
+
+	Vector<int> expected;
+	for (int i = 1; i < 20; i += 2) {
+		expected.push_back(i);
+	}
+	expected.push_back(100);
+	expected.push_back(0);
+
+	int idx = 0;
+	for (const KeyValue<int, int> &E : map) {
+		CHECK(E.key == expected[idx]);
+		CHECK(map.find_at_index(idx)->key == expected[idx]);
+		++idx;
+	}
+	CHECK(idx == expected.size());
+}
+
+TEST_CASE("[ChunkedHashMap] Pointers stay valid while growing") {
+	ChunkedHashMap<int, int> map;
+	int *value = &map[7];
+	*value = 1;
+	for (int i = 0; i < 500; i++) {
+		if (i != 7) {
+			map.insert(i, 0);
+		}
+	}
+	for (int i = 0; i < 500; i += 2) {
+		map.erase(i);
+	}
+
+	CHECK(map.getptr(7) == value);
+	CHECK(*value == 1);
+}
+
+TEST_CASE("[ChunkedHashMap] Copy") {
+	ChunkedHashMap<int, int> map;
+	for (int i = 0; i < 12; i++) {
+		map.insert(i, 12 - i);
+	}
+
+	const ChunkedHashMap<int, int> copy = map;
+	map.clear();
+
+	CHECK(copy.size() == 12);
+	int idx = 0;
+	for (const KeyValue<int, int> &E : copy) {
+		CHECK(E.key == idx);
+		CHECK(E.value == 12 - idx);
+		++idx;
+	}
+}
+
+} // namespace TestChunkedHashMap
+
+#endif // TEST_CHUNKED_HASH_MAP_H
@@ -297,6 +297,55 @@ TEST_CASE("[Vector] Slice") {
 	ERR_PRINT_ON;
 }
 
+TEST_CASE("[Vector] Shared slice") {
+	Vector<int> vector;
+	vector.push_back(0);
+	vector.push_back(1);
+	vector.push_back(2);
+	vector.push_back(3);
+	vector.push_back(4);
+
+	VectorSlice<int> slice0 = vector.shared_slice(1, -1);
+	CHECK(slice0.size() == 3);
+	CHECK(slice0[0] == 1);
+	CHECK(slice0[2] == 3);
+	CHECK_MESSAGE(slice0.ptr() == vector.ptr() + 1, "The slice should point into the Vector's buffer instead of copying it.");
+
+	VectorSlice<int> slice1 = slice0.slice(1);
+	CHECK(slice1.size() == 2);
+	CHECK(slice1[0] == 2);
+	CHECK(slice1[1] == 3);
+	CHECK(slice1.ptr() == vector.ptr() + 2);
+	CHECK(slice1 == vector.shared_slice(2, 4));
+
+	int sum = 0;
+	for (const int &E : slice1) {
+		sum += E;
+	}
+	CHECK(sum == 5);
+
+	Vector<int> copy = slice1.to_vector();
+	CHECK(copy.size() == 2);
+	CHECK(copy[0] == 2);
+	CHECK(copy[1] == 3);
+
+	// Covering the whole Vector doesn't copy.
+	Vector<int> whole = vector.shared_slice(0).to_vector();
+	CHECK(whole.ptr() == vector.ptr());
+
+	// Writing to the Vector copies its buffer, slices keep the original data.
+	const int *old_ptr = vector.ptr();
+	vector.set(2, 42);
+	CHECK(vector[2] == 42);
+	CHECK(slice1[0] == 2);
+	CHECK(slice1.ptr() == old_ptr + 2);
+
+	ERR_PRINT_OFF;
+	VectorSlice<int> slice2 = vector.shared_slice(5, 1);
+	CHECK(slice2.is_empty()); // Expected to fail.
+	ERR_PRINT_ON;
+}
+
 TEST_CASE("[Vector] Find, has") {
 	Vector<int> vector;
 	vector.push_back(3);
@@ -136,6 +136,28 @@ TEST_CASE("[Animation] Create 3D position track") {
 	ERR_PRINT_ON;
 }
 
+TEST_CASE("[Animation] Sample 3D position track with a cursor") {
+	Ref<Animation> animation = memnew(Animation);
+	animation->set_length(2.0);
+	animation->set_loop_mode(Animation::LOOP_LINEAR);
+	const int track_index = animation->add_track(Animation::TYPE_POSITION_3D);
+	animation->track_set_path(track_index, NodePath("Enemy:position"));
+	for (int i = 0; i < 20; i++) {
+		animation->position_track_insert_key(track_index, i * 0.1, Vector3(i, i * i, -i));
+	}
+
+	// Forward in small and large steps, repeated times, key times, and back to the start.
+	const double times[] = { 0.0, 0.0, 0.05, 0.1, 0.1, 0.17, 0.3, 0.31, 1.2, 1.25, 1.9, 1.95, 0.02, 0.4, -0.1, 0.6 };
+	int cursor = -1;
+	for (double time : times) {
+		Vector3 expected;
+		Vector3 sampled;
+		CHECK(animation->try_position_track_interpolate(track_index, time, &expected) == OK);
+		CHECK(animation->try_position_track_interpolate(track_index, time, &sampled, &cursor) == OK);
+		CHECK_MESSAGE(sampled.is_equal_approx(expected), vformat("Sampling with a cursor at %f should match.", time));
+	}
+}
+
 TEST_CASE("[Animation] Create 3D rotation track") {
 	Ref<Animation> animation = memnew(Animation);
 	const int track_index = animation->add_track(Animation::TYPE_ROTATION_3D);
@@ -0,0 +1,264 @@
+/**************************************************************************/
+/*  test_animation_player.h                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_ANIMATION_PLAYER_H
+#define TEST_ANIMATION_PLAYER_H
+
+#include "scene/2d/node_2d.h"
+#include "scene/3d/skeleton_3d.h"
+#include "scene/animation/animation_player.h"
+#include "scene/main/window.h"
+
+#include "tests/test_macros.h"
+
+namespace TestAnimationPlayer {
+
+TEST_CASE("[SceneTree][AnimationPlayer] Threaded blending") {
+	Ref<Animation> animation;
+	animation.instantiate();
+	const int track = animation->add_track(Animation::TYPE_VALUE);
+	animation->track_set_path(track, NodePath("Character:position:x"));
+	animation->track_insert_key(track, 0.0, 0.0);
+	animation->track_insert_key(track, 1.0, 100.0);
+
+	Ref<AnimationLibrary> library;
+	library.instantiate();
+	library->add_animation("move", animation);
+
+	// Half of the characters blend on the main thread, to compare with.
+	const int count = 16;
+	Node *roots[count];
+	Node2D *characters[count];
+	AnimationPlayer *players[count];
+	for (int i = 0; i < count; i++) {
+		roots[i] = memnew(Node);
+		characters[i] = memnew(Node2D);
+		characters[i]->set_name("Character");
+		roots[i]->add_child(characters[i]);
+		players[i] = memnew(AnimationPlayer);
+		players[i]->set_threaded_blending_enabled(i % 2 == 1);
+		players[i]->add_animation_library("", library);
+		roots[i]->add_child(players[i]);
+		SceneTree::get_singleton()->get_root()->add_child(roots[i]);
+		players[i]->play("move");
+	}
+
+	SUBCASE("Threaded mixers reach the same result") {
+		SceneTree::get_singleton()->process(0.25);
+		for (int i = 1; i < count; i++) {
+			CHECK(characters[i]->get_position().x == doctest::Approx(characters[0]->get_position().x));
+		}
+
+		SceneTree::get_singleton()->process(0.25);
+		CHECK(characters[0]->get_position().x > 0);
+		for (int i = 1; i < count; i++) {
+			CHECK(characters[i]->get_position().x == doctest::Approx(characters[0]->get_position().x));
+		}
+	}
+
+	SUBCASE("Mixers removed from the tree are not applied") {
+		for (int i = 0; i < count; i++) {
+			players[i]->set_threaded_blending_enabled(true);
+		}
+		SceneTree::get_singleton()->process(0.25);
+		const real_t x = characters[1]->get_position().x;
+
+		// Removing a mixer while it's queued must not touch it afterwards.
+		players[1]->notification(Node::NOTIFICATION_INTERNAL_PROCESS);
+		roots[1]->remove_child(players[1]);
+		SceneTree::get_singleton()->process(0.25);
+		CHECK(characters[1]->get_position().x == doctest::Approx(x));
+		CHECK(characters[0]->get_position().x > x);
+
+		roots[1]->add_child(players[1]);
+	}
+
+	for (int i = 0; i < count; i++) {
+		memdelete(roots[i]);
+	}
+}
+
+TEST_CASE("[SceneTree][AnimationPlayer] Tracks added while playing") {
+	Ref<Animation> animation;
+	animation.instantiate();
+	const int track_x = animation->add_track(Animation::TYPE_VALUE);
+	animation->track_set_path(track_x, NodePath("Character:position:x"));
+	animation->track_insert_key(track_x, 0.0, 0.0);
+	animation->track_insert_key(track_x, 1.0, 100.0);
+
+	Ref<AnimationLibrary> library;
+	library.instantiate();
+	library->add_animation("move", animation);
+
+	Node *root = memnew(Node);
+	Node2D *character = memnew(Node2D);
+	character->set_name("Character");
+	root->add_child(character);
+	AnimationPlayer *player = memnew(AnimationPlayer);
+	player->add_animation_library("", library);
+	root->add_child(player);
+	SceneTree::get_singleton()->get_root()->add_child(root);
+	player->play("move");
+
+	SceneTree::get_singleton()->process(0.25);
+	SceneTree::get_singleton()->process(0.25);
+	CHECK(character->get_position().x > 0);
+	CHECK(character->get_position().y == doctest::Approx(0));
+
+	const int track_y = animation->add_track(Animation::TYPE_VALUE);
+	animation->track_set_path(track_y, NodePath("Character:position:y"));
+	animation->track_insert_key(track_y, 0.0, 0.0);
+	animation->track_insert_key(track_y, 1.0, 100.0);
+
+	SceneTree::get_singleton()->process(0.25);
+	CHECK_MESSAGE(character->get_position().y > 0, "The new track should be blended as well.");
+	CHECK(character->get_position().y == doctest::Approx(character->get_position().x));
+
+	memdelete(root);
+}
+
+TEST_CASE("[SceneTree][AnimationPlayer] Level of detail") {
+	Ref<Animation> animation;
+	animation.instantiate();
+	const int track = animation->add_track(Animation::TYPE_VALUE);
+	animation->track_set_path(track, NodePath("Character:position:x"));
+	animation->track_insert_key(track, 0.0, 0.0);
+	animation->track_insert_key(track, 1.0, 100.0);
+
+	Ref<AnimationLibrary> library;
+	library.instantiate();
+	library->add_animation("move", animation);
+
+	Node *root = memnew(Node);
+	Node2D *character = memnew(Node2D);
+	character->set_name("Character");
+	root->add_child(character);
+	AnimationPlayer *player = memnew(AnimationPlayer);
+	player->add_animation_library("", library);
+	root->add_child(player);
+	SceneTree::get_singleton()->get_root()->add_child(root);
+	player->play("move");
+	player->seek(0.1, true);
+	CHECK(character->get_position().x == doctest::Approx(10));
+
+	// Updated 30 times per second by default.
+	player->set_lod_level(AnimationMixer::LOD_LEVEL_REDUCED);
+	SceneTree::get_singleton()->process(0.02);
+	CHECK_MESSAGE(character->get_position().x == doctest::Approx(10), "The update should be skipped.");
+	SceneTree::get_singleton()->process(0.02);
+	CHECK_MESSAGE(character->get_position().x == doctest::Approx(14), "The skipped time should be made up for.");
+
+	player->set_lod_level(AnimationMixer::LOD_LEVEL_FULL);
+	SceneTree::get_singleton()->process(0.01);
+	CHECK(character->get_position().x == doctest::Approx(15));
+
+	memdelete(root);
+}
+
+#ifndef _3D_DISABLED
+TEST_CASE("[SceneTree][AnimationPlayer] Blending bone transforms") {
+	// Bone 1 is animated by both animations, bone 0 only by "raise".
+	Ref<Animation> raise;
+	raise.instantiate();
+	int track = raise->add_track(Animation::TYPE_POSITION_3D);
+	raise->track_set_path(track, NodePath("Skeleton:Bone1"));
+	raise->position_track_insert_key(track, 0.0, Vector3(1, 0, 0));
+	track = raise->add_track(Animation::TYPE_ROTATION_3D);
+	raise->track_set_path(track, NodePath("Skeleton:Bone1"));
+	raise->rotation_track_insert_key(track, 0.0, Quaternion(Vector3(1, 0, 0), Math_PI / 2));
+	track = raise->add_track(Animation::TYPE_SCALE_3D);
+	raise->track_set_path(track, NodePath("Skeleton:Bone0"));
+	raise->scale_track_insert_key(track, 0.0, Vector3(1, 1, 1));
+	raise->scale_track_insert_key(track, 1.0, Vector3(3, 3, 3));
+
+	Ref<Animation> lift;
+	lift.instantiate();
+	track = lift->add_track(Animation::TYPE_POSITION_3D);
+	lift->track_set_path(track, NodePath("Skeleton:Bone1"));
+	lift->position_track_insert_key(track, 0.0, Vector3(0, 2, 0));
+
+	Ref<AnimationLibrary> library;
+	library.instantiate();
+	library->add_animation("raise", raise);
+	library->add_animation("lift", lift);
+
+	// The second one blends on a worker thread, to compare with.
+	const int count = 2;
+	Node *roots[count];
+	Skeleton3D *skeletons[count];
+	AnimationPlayer *players[count];
+	for (int i = 0; i < count; i++) {
+		roots[i] = memnew(Node);
+		skeletons[i] = memnew(Skeleton3D);
+		skeletons[i]->set_name("Skeleton");
+		skeletons[i]->add_bone("Bone0");
+		skeletons[i]->add_bone("Bone1");
+		skeletons[i]->set_bone_parent(1, 0);
+		roots[i]->add_child(skeletons[i]);
+		players[i] = memnew(AnimationPlayer);
+		players[i]->set_threaded_blending_enabled(i == 1);
+		players[i]->add_animation_library("", library);
+		roots[i]->add_child(players[i]);
+		SceneTree::get_singleton()->get_root()->add_child(roots[i]);
+		players[i]->play("raise");
+		players[i]->seek(0.5, true);
+	}
+
+	for (int i = 0; i < count; i++) {
+		CHECK(skeletons[i]->get_bone_pose_scale(0).is_equal_approx(Vector3(2, 2, 2)));
+		CHECK(skeletons[i]->get_bone_pose_position(1).is_equal_approx(Vector3(1, 0, 0)));
+		CHECK(skeletons[i]->get_bone_pose_rotation(1).is_equal_approx(Quaternion(Vector3(1, 0, 0), Math_PI / 2)));
+	}
+
+	// While crossfading, each animation contributes by its weight.
+	for (int i = 0; i < count; i++) {
+		players[i]->play("lift", 1.0);
+	}
+	SceneTree::get_singleton()->process(0.25);
+	SceneTree::get_singleton()->process(0.25);
+	const Vector3 position = skeletons[0]->get_bone_pose_position(1);
+	CHECK(position.x > 0);
+	CHECK(position.x < 1);
+	CHECK(position.x + position.y / 2 == doctest::Approx(1));
+	CHECK(position.z == doctest::Approx(0));
+	CHECK(skeletons[0]->get_bone_pose_rotation(1).is_equal_approx(Quaternion(Vector3(1, 0, 0), position.x * Math_PI / 2)));
+	CHECK(skeletons[1]->get_bone_pose_position(1).is_equal_approx(position));
+	CHECK(skeletons[1]->get_bone_pose_rotation(1).is_equal_approx(skeletons[0]->get_bone_pose_rotation(1)));
+	CHECK(skeletons[1]->get_bone_pose_scale(0).is_equal_approx(skeletons[0]->get_bone_pose_scale(0)));
+
+	for (int i = 0; i < count; i++) {
+		memdelete(roots[i]);
+	}
+}
+#endif // _3D_DISABLED
+
+} // namespace TestAnimationPlayer
+
+#endif // TEST_ANIMATION_PLAYER_H
@@ -762,6 +762,116 @@ TEST_CASE("[SceneTree][Node] Test the process priority") {
 	memdelete(node4);
 }
 
+TEST_CASE("[SceneTree][Node] Test processing sub thread groups split in chunks") {
+	Node *split_group = memnew(Node);
+	split_group->set_process_thread_group(Node::PROCESS_THREAD_GROUP_SUB_THREAD);
+	split_group->set_process_thread_group_chunk_size(3);
+	SceneTree::get_singleton()->get_root()->add_child(split_group);
+
+	Node *whole_group = memnew(Node);
+	whole_group->set_process_thread_group(Node::PROCESS_THREAD_GROUP_SUB_THREAD);
+	SceneTree::get_singleton()->get_root()->add_child(whole_group);
+
+	const int node_count = 10;
+	TestNode *split_nodes[node_count];
+	TestNode *whole_nodes[node_count];
+	for (int i = 0; i < node_count; i++) {
+		split_nodes[i] = memnew(TestNode);
+		split_group->add_child(split_nodes[i]);
+		split_nodes[i]->set_process(true);
+		split_nodes[i]->set_physics_process(true);
+
+		whole_nodes[i] = memnew(TestNode);
+		whole_group->add_child(whole_nodes[i]);
+		whole_nodes[i]->set_process(true);
+	}
+
+	// Each node is processed once per frame, whether its group is split or not.
+	SceneTree::get_singleton()->process(0);
+	SceneTree::get_singleton()->process(0);
+	SceneTree::get_singleton()->physics_process(0);
+
+	for (int i = 0; i < node_count; i++) {
+		CHECK_EQ(2, split_nodes[i]->process_counter);
+		CHECK_EQ(1, split_nodes[i]->physics_process_counter);
+		CHECK_EQ(2, whole_nodes[i]->process_counter);
+		CHECK_EQ(0, whole_nodes[i]->physics_process_counter);
+	}
+
+	// Nodes removed from processing are no longer processed.
+	split_nodes[0]->set_process(false);
+	SceneTree::get_singleton()->process(0);
+	CHECK_EQ(2, split_nodes[0]->process_counter);
+	CHECK_EQ(3, split_nodes[node_count - 1]->process_counter);
+
+	memdelete(split_group);
+	memdelete(whole_group);
+}
+
+TEST_CASE("[SceneTree][Node] Group membership stays in tree order") {
+	Node *root = SceneTree::get_singleton()->get_root();
+
+	const int node_count = 8;
+	Node *nodes[node_count];
+	for (int i = 0; i < node_count; i++) {
+		nodes[i] = memnew(Node);
+		root->add_child(nodes[i]);
+	}
+
+	// Added out of tree order.
+	for (int i = node_count - 1; i >= 0; i--) {
+		nodes[i]->add_to_group("members");
+	}
+	CHECK_EQ(SceneTree::get_singleton()->get_node_count_in_group("members"), node_count);
+	CHECK_EQ(SceneTree::get_singleton()->get_first_node_in_group("members"), nodes[0]);
+
+	SUBCASE("Removed and re-added members keep the tree order") {
+		nodes[2]->remove_from_group("members");
+		nodes[5]->remove_from_group("members");
+		nodes[7]->remove_from_group("members");
+		CHECK_EQ(SceneTree::get_singleton()->get_node_count_in_group("members"), node_count - 3);
+		CHECK_FALSE(nodes[2]->is_in_group("members"));
+
+		nodes[5]->add_to_group("members");
+		nodes[2]->add_to_group("members");
+		nodes[0]->remove_from_group("members");
+
+		List<Node *> members;
+		SceneTree::get_singleton()->get_nodes_in_group("members", &members);
+		REQUIRE_EQ(members.size(), node_count - 2);
+		List<Node *>::Element *E = members.front();
+		for (int i : { 1, 2, 3, 4, 5, 6 }) {
+			CHECK_EQ(E->get(), nodes[i]);
+			E = E->next();
+		}
+
+		// Removing every member removes the group.
+		for (int i = 0; i < node_count; i++) {
+			if (nodes[i]->is_in_group("members")) {
+				nodes[i]->remove_from_group("members");
+			}
+		}
+		CHECK_FALSE(SceneTree::get_singleton()->has_group("members"));
+	}
+
+	SUBCASE("Moving a member reorders the group") {
+		root->move_child(nodes[6], 0);
+		CHECK_EQ(SceneTree::get_singleton()->get_first_node_in_group("members"), nodes[6]);
+	}
+
+	SUBCASE("Calling the group reaches every member once") {
+		nodes[3]->remove_from_group("members");
+		SceneTree::get_singleton()->call_group("members", "set_process_priority", 7);
+		for (int i = 0; i < node_count; i++) {
+			CHECK_EQ(nodes[i]->get_process_priority(), i == 3 ? 0 : 7);
+		}
+	}
+
+	for (int i = 0; i < node_count; i++) {
+		memdelete(nodes[i]);
+	}
+}
+
 } // namespace TestNode
 
 #endif // TEST_NODE_H
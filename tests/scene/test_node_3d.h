@@ -0,0 +1,143 @@
+/**************************************************************************/
+/*  test_node_3d.h                                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_NODE_3D_H
+#define TEST_NODE_3D_H
+
+#include "scene/3d/node_3d.h"
+#include "scene/main/window.h"
+
+#include "tests/test_macros.h"
+
+namespace TestNode3D {
+
+class TransformNotifiedNode3D : public Node3D {
+	GDCLASS(TransformNotifiedNode3D, Node3D);
+
+protected:
+	void _notification(int p_what) {
+		if (p_what == NOTIFICATION_TRANSFORM_CHANGED) {
+			notification_count++;
+		}
+	}
+
+public:
+	int notification_count = 0;
+
+	void set_global_position_without_notification(const Vector3 &p_position) {
+		set_ignore_transform_notification(true);
+		set_global_position(p_position);
+		set_ignore_transform_notification(false);
+	}
+
+	TransformNotifiedNode3D() {
+		set_notify_transform(true);
+	}
+};
+
+TEST_CASE("[SceneTree][Node3D] Global transform propagation") {
+	SceneTree *tree = SceneTree::get_singleton();
+
+	Node3D *root = memnew(Node3D);
+	Node3D *middle = memnew(Node3D);
+	TransformNotifiedNode3D *leaf = memnew(TransformNotifiedNode3D);
+	root->add_child(middle);
+	middle->add_child(leaf);
+	tree->get_root()->add_child(root);
+	tree->flush_transform_notifications();
+	leaf->notification_count = 0;
+
+	SUBCASE("Moving several ancestors in a frame updates descendants and notifies them once") {
+		root->set_position(Vector3(1, 0, 0));
+		middle->set_position(Vector3(0, 2, 0));
+		root->set_position(Vector3(3, 0, 0));
+		leaf->set_position(Vector3(0, 0, 4));
+		tree->flush_transform_notifications();
+		CHECK(leaf->notification_count == 1);
+		CHECK(leaf->get_global_position().is_equal_approx(Vector3(3, 2, 4)));
+
+		// The next frame must dirty and notify again.
+		middle->set_position(Vector3(0, 5, 0));
+		tree->flush_transform_notifications();
+		CHECK(leaf->notification_count == 2);
+		CHECK(leaf->get_global_position().is_equal_approx(Vector3(3, 5, 4)));
+	}
+
+	SUBCASE("Descendants are updated when nobody reads their global transform") {
+		root->set_position(Vector3(1, 0, 0));
+		root->set_position(Vector3(2, 0, 0));
+		CHECK(middle->get_global_position().is_equal_approx(Vector3(2, 0, 0)));
+		root->set_position(Vector3(3, 0, 0));
+		CHECK(middle->get_global_position().is_equal_approx(Vector3(3, 0, 0)));
+		CHECK(leaf->get_global_position().is_equal_approx(Vector3(3, 0, 0)));
+	}
+
+	SUBCASE("A node whose own notification was ignored is notified when its parent moves") {
+		leaf->set_global_position_without_notification(Vector3(0, 0, 1));
+		tree->flush_transform_notifications();
+		CHECK(leaf->notification_count == 0);
+
+		middle->set_position(Vector3(0, 1, 0));
+		tree->flush_transform_notifications();
+		CHECK(leaf->notification_count == 1);
+		CHECK(leaf->get_global_position().is_equal_approx(Vector3(0, 1, 1)));
+	}
+
+	SUBCASE("Enabling notifications on a dirty node queues it") {
+		TransformNotifiedNode3D *other = memnew(TransformNotifiedNode3D);
+		other->set_notify_transform(false);
+		middle->add_child(other);
+		tree->flush_transform_notifications();
+
+		root->set_position(Vector3(1, 0, 0));
+		other->set_notify_transform(true);
+		tree->flush_transform_notifications();
+		CHECK(other->notification_count == 1);
+
+		memdelete(other);
+	}
+
+	SUBCASE("Top level nodes follow their parent again once no longer top level") {
+		leaf->set_as_top_level(true);
+		root->set_position(Vector3(5, 0, 0));
+		CHECK(leaf->get_global_position().is_equal_approx(Vector3()));
+
+		leaf->set_as_top_level(false);
+		CHECK(leaf->get_global_position().is_equal_approx(Vector3()));
+		root->set_position(Vector3(6, 0, 0));
+		CHECK(leaf->get_global_position().is_equal_approx(Vector3(1, 0, 0)));
+	}
+
+	memdelete(root);
+}
+
+} // namespace TestNode3D
+
+#endif // TEST_NODE_3D_H
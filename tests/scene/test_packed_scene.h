@@ -31,6 +31,8 @@
 #ifndef TEST_PACKED_SCENE_H
 #define TEST_PACKED_SCENE_H
 
+#include "scene/main/scene_tree.h"
+#include "scene/main/window.h"
 #include "scene/resources/packed_scene.h"
 
 #include "tests/test_macros.h"
@@ -150,6 +152,147 @@ TEST_CASE("[PackedScene] Instantiate Packed Scene With Children") {
 	memdelete(instance);
 }
 
+TEST_CASE("[PackedScene] Instantiate Multiple Copies With Properties And Connections") {
+	// Create a scene to pack.
+	Node *scene = memnew(Node);
+	scene->set_name("TestScene");
+	scene->set_process_priority(3);
+
+	Node *child = memnew(Node);
+	child->set_name("Child");
+	child->set_editor_description("Description");
+	scene->add_child(child);
+	child->set_owner(scene);
+	child->connect("renamed", Callable(scene, "queue_free").bind(42), Object::CONNECT_PERSIST);
+
+	// Pack the scene.
+	PackedScene packed_scene;
+	packed_scene.pack(scene);
+
+	// Instantiate several copies of the packed scene.
+	TypedArray<Node> instances = packed_scene.instantiate_multiple(3);
+	REQUIRE(instances.size() == 3);
+	for (int i = 0; i < instances.size(); i++) {
+		Node *instance = Object::cast_to<Node>(instances[i]);
+		REQUIRE(instance != nullptr);
+		CHECK(instance->get_process_priority() == 3);
+		REQUIRE(instance->get_child_count() == 1);
+
+		Node *instance_child = instance->get_child(0);
+		CHECK(instance_child->get_editor_description() == "Description");
+		CHECK(instance_child->is_connected("renamed", Callable(instance, "queue_free")));
+		memdelete(instance);
+	}
+
+	// Packing again must not reuse what was resolved for the previous scene.
+	scene->set_process_priority(7);
+	child->set_editor_description("Changed");
+	packed_scene.pack(scene);
+
+	Node *instance = packed_scene.instantiate();
+	REQUIRE(instance != nullptr);
+	CHECK(instance->get_process_priority() == 7);
+	CHECK(instance->get_child(0)->get_editor_description() == "Changed");
+
+	memdelete(instance);
+	memdelete(scene);
+}
+
+TEST_CASE("[PackedScene] Pooled Instances Are Reset On Release") {
+	// Create a scene to pack.
+	Node *scene = memnew(Node);
+	scene->set_name("TestScene");
+	scene->set_process_priority(3);
+
+	Node *child = memnew(Node);
+	child->set_name("Child");
+	child->set_editor_description("Description");
+	scene->add_child(child);
+	child->set_owner(scene);
+	child->connect("renamed", Callable(scene, "queue_free"), Object::CONNECT_PERSIST);
+	child->add_to_group("packed_group", true);
+
+	Ref<PackedScene> packed_scene;
+	packed_scene.instantiate();
+	packed_scene->pack(scene);
+
+	SceneTree *tree = SceneTree::get_singleton();
+	Node *instance = tree->pool_instantiate(packed_scene);
+	REQUIRE(instance != nullptr);
+	ObjectID instance_id = instance->get_instance_id();
+	tree->get_root()->add_child(instance);
+
+	// Change saved properties, one that the scene leaves at its default, and the name.
+	instance->set_process_priority(9);
+	instance->set_physics_process_priority(5);
+	instance->set_name("Renamed");
+	instance->get_child(0)->set_editor_description("Changed");
+
+	// Change the children and groups.
+	Node *runtime_child = memnew(Node);
+	runtime_child->set_name("RuntimeChild");
+	instance->add_child(runtime_child);
+	ObjectID runtime_child_id = runtime_child->get_instance_id();
+	Node *runtime_grandchild = memnew(Node);
+	instance->get_child(0)->add_child(runtime_grandchild);
+	ObjectID runtime_grandchild_id = runtime_grandchild->get_instance_id();
+	Node *owned_child = memnew(Node);
+	owned_child->set_name("OwnedChild");
+	instance->add_child(owned_child);
+	owned_child->set_owner(instance);
+	instance->add_to_group("runtime_group");
+	instance->get_child(0)->remove_from_group("packed_group");
+
+	tree->pool_release(instance);
+	CHECK(instance->get_parent() == nullptr);
+	CHECK(tree->pool_get_available_count(packed_scene) == 1);
+
+	// The same node comes back, reset to the scene's values and still connected.
+	Node *reused = tree->pool_instantiate(packed_scene);
+	CHECK(reused == instance);
+	CHECK(reused->get_instance_id() == instance_id);
+	CHECK(tree->pool_get_available_count(packed_scene) == 0);
+	CHECK(reused->get_name() == StringName("TestScene"));
+	CHECK(reused->get_process_priority() == 3);
+	CHECK(reused->get_physics_process_priority() == 0);
+	REQUIRE(reused->get_child_count() == 2);
+	CHECK(reused->get_child(0)->get_editor_description() == "Description");
+	CHECK(reused->get_child(0)->is_connected("renamed", Callable(reused, "queue_free")));
+	CHECK(reused->get_child(0)->is_in_group("packed_group"));
+	CHECK_FALSE(reused->is_in_group("runtime_group"));
+
+	// Children that aren't owned by a node of the instance are freed, the others are kept.
+	CHECK(ObjectDB::get_instance(runtime_child_id) == nullptr);
+	CHECK(ObjectDB::get_instance(runtime_grandchild_id) == nullptr);
+	CHECK(reused->get_child(0)->get_child_count() == 0);
+	CHECK(reused->get_child(1) == owned_child);
+	memdelete(owned_child);
+
+	ERR_PRINT_OFF;
+	// Releasing twice, or a node that doesn't come from a pool, is an error.
+	tree->pool_release(reused);
+	tree->pool_release(reused);
+	CHECK(tree->pool_get_available_count(packed_scene) == 1);
+	tree->pool_release(scene);
+	ERR_PRINT_ON;
+
+	// An instance whose nodes changed can't be reset, so it is freed instead of pooled.
+	reused = tree->pool_instantiate(packed_scene);
+	memdelete(reused->get_child(0));
+	tree->pool_release(reused);
+	CHECK(reused->is_queued_for_deletion());
+	CHECK(tree->pool_get_available_count(packed_scene) == 0);
+
+	Node *other = tree->pool_instantiate(packed_scene);
+	CHECK(other != reused);
+	tree->pool_release(other);
+	CHECK(tree->pool_get_available_count(packed_scene) == 1);
+	tree->pool_clear(packed_scene);
+	CHECK(tree->pool_get_available_count(packed_scene) == 0);
+
+	memdelete(scene);
+}
+
 TEST_CASE("[PackedScene] Set Path") {
 	// Create a scene to pack.
 	Node *scene = memnew(Node);
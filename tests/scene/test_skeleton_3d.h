@@ -0,0 +1,128 @@
+/**************************************************************************/
+/*  test_skeleton_3d.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_SKELETON_3D_H
+#define TEST_SKELETON_3D_H
+
+#include "scene/3d/skeleton_3d.h"
+#include "scene/main/window.h"
+
+#include "tests/test_macros.h"
+
+namespace TestSkeleton3D {
+
+class BonePoseChangedCounter : public Object {
+	GDCLASS(BonePoseChangedCounter, Object);
+
+public:
+	LocalVector<int> changed_bones;
+
+	void bone_pose_changed(int p_bone) {
+		changed_bones.push_back(p_bone);
+	}
+};
+
+TEST_CASE("[SceneTree][Skeleton3D] Only bones whose chain changed are updated") {
+	Skeleton3D *skeleton = memnew(Skeleton3D);
+	// root -> arm -> hand, root -> leg.
+	skeleton->add_bone("root");
+	skeleton->add_bone("arm");
+	skeleton->add_bone("hand");
+	skeleton->add_bone("leg");
+	skeleton->set_bone_parent(1, 0);
+	skeleton->set_bone_parent(2, 1);
+	skeleton->set_bone_parent(3, 0);
+	for (int i = 0; i < 4; i++) {
+		skeleton->set_bone_rest(i, Transform3D(Basis(), Vector3(0, 1, 0)));
+		skeleton->set_bone_pose_position(i, Vector3(0, 1, 0));
+	}
+	SceneTree::get_singleton()->get_root()->add_child(skeleton);
+	CHECK(skeleton->get_bone_global_pose(2).origin.is_equal_approx(Vector3(0, 3, 0)));
+
+	BonePoseChangedCounter *counter = memnew(BonePoseChangedCounter);
+	skeleton->connect("bone_pose_changed", callable_mp(counter, &BonePoseChangedCounter::bone_pose_changed));
+
+	SUBCASE("Moving a bone updates it and its descendants only") {
+		skeleton->set_bone_pose_position(1, Vector3(1, 1, 0));
+		CHECK(skeleton->get_bone_global_pose(2).origin.is_equal_approx(Vector3(1, 3, 0)));
+		CHECK(skeleton->get_bone_global_pose(3).origin.is_equal_approx(Vector3(0, 2, 0)));
+		CHECK(counter->changed_bones.size() == 2);
+		CHECK(counter->changed_bones[0] == 1);
+		CHECK(counter->changed_bones[1] == 2);
+
+		counter->changed_bones.clear();
+		skeleton->set_bone_pose_position(3, Vector3(0, 0, 2));
+		CHECK(skeleton->get_bone_global_pose(3).origin.is_equal_approx(Vector3(0, 1, 2)));
+		CHECK(skeleton->get_bone_global_pose(2).origin.is_equal_approx(Vector3(1, 3, 0)));
+		CHECK(counter->changed_bones.size() == 1);
+		CHECK(counter->changed_bones[0] == 3);
+	}
+
+	SUBCASE("Changing a rest updates every bone") {
+		skeleton->set_bone_rest(0, Transform3D(Basis(), Vector3(0, 0, 5)));
+		CHECK(skeleton->get_bone_global_rest(2).origin.is_equal_approx(Vector3(0, 2, 5)));
+		CHECK(counter->changed_bones.size() == 4);
+	}
+
+	SUBCASE("A global pose override is removed by the next update") {
+		skeleton->set_bone_global_pose_override(2, Transform3D(Basis(), Vector3(5, 5, 5)), 1.0);
+		CHECK(skeleton->get_bone_global_pose(2).origin.is_equal_approx(Vector3(5, 5, 5)));
+
+		skeleton->set_bone_pose_position(3, Vector3(0, 2, 0));
+		CHECK(skeleton->get_bone_global_pose(3).origin.is_equal_approx(Vector3(0, 3, 0)));
+		CHECK(skeleton->get_bone_global_pose(2).origin.is_equal_approx(Vector3(0, 3, 0)));
+	}
+
+	SUBCASE("Bones updated by force_update_bone_children_transforms() are sent to the skins") {
+		Ref<Skin> skin;
+		skin.instantiate();
+		for (int i = 0; i < 4; i++) {
+			skin->add_bind(i, Transform3D(Basis(), Vector3(0, 0, -1)));
+		}
+		Ref<SkinReference> skin_ref = skeleton->register_skin(skin);
+		skeleton->force_update_all_dirty_bones();
+		RID rs_skeleton = skin_ref->get_skeleton();
+		CHECK(RS::get_singleton()->skeleton_bone_get_transform(rs_skeleton, 2).origin.is_equal_approx(Vector3(0, 3, -1)));
+
+		skeleton->set_bone_pose_position(1, Vector3(1, 1, 0));
+		skeleton->force_update_bone_children_transforms(1);
+		skeleton->force_update_all_dirty_bones();
+		CHECK(RS::get_singleton()->skeleton_bone_get_transform(rs_skeleton, 1).origin.is_equal_approx(Vector3(1, 2, -1)));
+		CHECK(RS::get_singleton()->skeleton_bone_get_transform(rs_skeleton, 2).origin.is_equal_approx(Vector3(1, 3, -1)));
+		CHECK(RS::get_singleton()->skeleton_bone_get_transform(rs_skeleton, 3).origin.is_equal_approx(Vector3(0, 2, -1)));
+	}
+
+	memdelete(counter);
+	memdelete(skeleton);
+}
+
+} // namespace TestSkeleton3D
+
+#endif // TEST_SKELETON_3D_H
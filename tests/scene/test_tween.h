@@ -0,0 +1,68 @@
+/**************************************************************************/
+/*  test_tween.h                                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_TWEEN_H
+#define TEST_TWEEN_H
+
+#include "scene/2d/node_2d.h"
+#include "scene/animation/tween.h"
+#include "scene/main/window.h"
+
+#include "tests/test_macros.h"
+
+namespace TestTween {
+
+TEST_CASE("[SceneTree][Tween] Property tweeners") {
+	Node2D *node = memnew(Node2D);
+	SceneTree::get_singleton()->get_root()->add_child(node);
+
+	Ref<Tween> tween = SceneTree::get_singleton()->create_tween();
+	tween->set_parallel(true);
+	tween->tween_property(node, NodePath("position"), Vector2(10, 20), 1.0);
+	tween->tween_property(node, NodePath("modulate:a"), 0.0, 1.0);
+	tween->tween_property(node, NodePath("rotation"), 1.0, 1.0)->as_relative();
+
+	tween->custom_step(0.5);
+	CHECK(node->get_position().is_equal_approx(Vector2(5, 10)));
+	CHECK(node->get_modulate().a == doctest::Approx(0.5));
+	CHECK(node->get_rotation() == doctest::Approx(0.5));
+
+	tween->custom_step(0.5);
+	CHECK(node->get_position().is_equal_approx(Vector2(10, 20)));
+	CHECK(node->get_modulate().a == doctest::Approx(0.0));
+	CHECK(node->get_rotation() == doctest::Approx(1.0));
+	CHECK_FALSE(tween->is_running());
+
+	memdelete(node);
+}
+
+} // namespace TestTween
+
+#endif // TEST_TWEEN_H
@@ -0,0 +1,287 @@
+/**************************************************************************/
+/*  test_audio_server.h                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_AUDIO_SERVER_H
+#define TEST_AUDIO_SERVER_H
+
+#include "scene/resources/audio_stream_wav.h"
+#include "servers/audio_server.h"
+
+#include "tests/test_macros.h"
+
+class TestAudioServerInternalsAccessor {
+public:
+	static uint32_t buffer_size() {
+		return AudioServer::get_singleton()->buffer_size;
+	}
+
+	static void mix_step_for_channel(AudioFrame *p_out_buf, AudioFrame *p_source_buf, AudioFrame p_vol_start, AudioFrame p_vol_final, float p_attenuation_filter_cutoff_hz, float p_highshelf_gain, AudioFilterSW::Processor *p_processor_l, AudioFilterSW::Processor *p_processor_r) {
+		AudioServer::get_singleton()->_mix_step_for_channel(p_out_buf, p_source_buf, p_vol_start, p_vol_final, p_attenuation_filter_cutoff_hz, p_highshelf_gain, p_processor_l, p_processor_r);
+	}
+
+	static void mix_steps(int p_count) {
+		for (int i = 0; i < p_count; i++) {
+			AudioServer::get_singleton()->_mix_step();
+		}
+	}
+
+	static void set_voice_virtualization(bool p_enabled, float p_threshold_db, int p_max_real_voices) {
+		AudioServer::get_singleton()->voice_virtualization = p_enabled;
+		AudioServer::get_singleton()->virtual_voice_threshold_linear = Math::db_to_linear(p_threshold_db);
+		AudioServer::get_singleton()->max_real_voices = p_max_real_voices;
+	}
+
+	static bool is_virtual(const Ref<AudioStreamPlayback> &p_playback) {
+		AudioServer::AudioStreamPlaybackListNode *playback_node = AudioServer::get_singleton()->_find_playback_list_node(p_playback);
+		return playback_node && playback_node->is_virtual;
+	}
+
+	static void start_decode_ahead_threads(int p_count) {
+		AudioServer::get_singleton()->_start_decode_ahead_threads(p_count);
+	}
+
+	static void finish_decode_ahead_threads() {
+		AudioServer::get_singleton()->_finish_decode_ahead_threads();
+	}
+
+	// Does what a decoder thread does for the playback, on the calling thread.
+	static void decode_ahead(const Ref<AudioStreamPlayback> &p_playback) {
+		AudioStreamPlaybackResampled *playback = Object::cast_to<AudioStreamPlaybackResampled>(p_playback.ptr());
+		playback->decode_ahead_requested.store(false);
+		playback->_decode_ahead();
+	}
+};
+
+namespace TestAudioServer {
+
+// Mixes one frame at a time, the way AudioServer did before its mixing loops were split by volume ramp.
+void mix_step_per_frame(AudioFrame *p_out_buf, const AudioFrame *p_source_buf, uint32_t p_frames, AudioFrame p_vol_start, AudioFrame p_vol_final, float p_attenuation_filter_cutoff_hz, float p_highshelf_gain) {
+	AudioFilterSW filter;
+	filter.set_mode(AudioFilterSW::HIGHSHELF);
+	filter.set_sampling_rate(AudioServer::get_singleton()->get_mix_rate());
+	filter.set_cutoff(p_attenuation_filter_cutoff_hz);
+	filter.set_resonance(1);
+	filter.set_stages(1);
+	filter.set_gain(p_highshelf_gain);
+
+	AudioFilterSW::Processor processor_l;
+	AudioFilterSW::Processor processor_r;
+	processor_l.set_filter(&filter);
+	processor_l.update_coeffs(p_frames);
+	processor_r.set_filter(&filter);
+	processor_r.update_coeffs(p_frames);
+
+	for (uint32_t i = 0; i < p_frames; i++) {
+		float lerp_param = (float)i / p_frames;
+		AudioFrame mixed = (p_vol_final * lerp_param + (1 - lerp_param) * p_vol_start) * p_source_buf[i];
+		if (p_highshelf_gain != 0) {
+			processor_l.process_one_interp(mixed.l);
+			processor_r.process_one_interp(mixed.r);
+		}
+		p_out_buf[i] += mixed;
+	}
+}
+
+TEST_CASE("[Audio][AudioServer] Mixing a playback into a channel matches the per-frame mix") {
+	const uint32_t frames = TestAudioServerInternalsAccessor::buffer_size();
+	LocalVector<AudioFrame> source;
+	LocalVector<AudioFrame> expected;
+	LocalVector<AudioFrame> mixed;
+	source.resize(frames);
+	expected.resize(frames);
+	mixed.resize(frames);
+	for (uint32_t i = 0; i < frames; i++) {
+		source[i] = AudioFrame(Math::sin(i * 0.05f), Math::cos(i * 0.03f));
+		// The mix is added to what the channel already holds.
+		expected[i] = AudioFrame(0.25f, -0.25f);
+		mixed[i] = expected[i];
+	}
+
+	AudioFrame vol_start;
+	AudioFrame vol_final;
+	float highshelf_gain = 0;
+
+	SUBCASE("Constant volume") {
+		vol_start = AudioFrame(0.5f, 0.75f);
+		vol_final = vol_start;
+	}
+	SUBCASE("Zero volume") {
+		vol_start = AudioFrame(0, 0);
+		vol_final = vol_start;
+	}
+	SUBCASE("Volume ramp") {
+		vol_start = AudioFrame(0, 1);
+		vol_final = AudioFrame(0.8f, 0.2f);
+	}
+	SUBCASE("Volume ramp with attenuation filter") {
+		vol_start = AudioFrame(0, 0);
+		vol_final = AudioFrame(0.8f, 0.6f);
+		highshelf_gain = 0.5f;
+	}
+
+	mix_step_per_frame(expected.ptr(), source.ptr(), frames, vol_start, vol_final, 5000.0f, highshelf_gain);
+	AudioFilterSW::Processor processor_l;
+	AudioFilterSW::Processor processor_r;
+	TestAudioServerInternalsAccessor::mix_step_for_channel(mixed.ptr(), source.ptr(), vol_start, vol_final, 5000.0f, highshelf_gain, &processor_l, &processor_r);
+
+	bool matches = true;
+	for (uint32_t i = 0; i < frames; i++) {
+		if (!Math::is_equal_approx(mixed[i].l, expected[i].l) || !Math::is_equal_approx(mixed[i].r, expected[i].r)) {
+			matches = false;
+			break;
+		}
+	}
+	CHECK_MESSAGE(matches, "The mixed frames should match the per-frame mix.");
+}
+
+Ref<AudioStreamWAV> make_sine_stream(float p_length, bool p_loop) {
+	const int frames = p_length * AudioServer::get_singleton()->get_mix_rate();
+	Vector<uint8_t> data;
+	data.resize(frames * 2);
+	int16_t *samples = reinterpret_cast<int16_t *>(data.ptrw());
+	for (int i = 0; i < frames; i++) {
+		samples[i] = Math::sin(i * 0.05f) * 16000;
+	}
+
+	Ref<AudioStreamWAV> stream;
+	stream.instantiate();
+	stream->set_format(AudioStreamWAV::FORMAT_16_BITS);
+	stream->set_mix_rate(AudioServer::get_singleton()->get_mix_rate());
+	stream->set_stereo(false);
+	stream->set_data(data);
+	if (p_loop) {
+		stream->set_loop_mode(AudioStreamWAV::LOOP_FORWARD);
+		stream->set_loop_end(frames);
+	}
+	return stream;
+}
+
+Vector<AudioFrame> bus_volumes(float p_volume_db) {
+	Vector<AudioFrame> volumes;
+	volumes.resize(AudioServer::MAX_CHANNELS_PER_BUS);
+	for (int i = 0; i < AudioServer::MAX_CHANNELS_PER_BUS; i++) {
+		float volume = Math::db_to_linear(p_volume_db);
+		volumes.write[i] = AudioFrame(volume, volume);
+	}
+	return volumes;
+}
+
+Ref<AudioStreamPlayback> start_playback(const Ref<AudioStream> &p_stream, float p_volume_db) {
+	Ref<AudioStreamPlayback> playback = p_stream->instantiate_playback();
+	AudioServer::get_singleton()->start_playback_stream(playback, SNAME("Master"), bus_volumes(p_volume_db));
+	return playback;
+}
+
+TEST_CASE("[Audio][AudioServer] Voice virtualization") {
+	AudioServer *audio_server = AudioServer::get_singleton();
+	// Mix by hand, without the driver's thread.
+	audio_server->lock();
+	TestAudioServerInternalsAccessor::set_voice_virtualization(true, -60.0, 0);
+	// Longer than the time a voice keeps its state after changing it.
+	const int hold_mixes = 0.5 * audio_server->get_mix_rate() / TestAudioServerInternalsAccessor::buffer_size();
+
+	Ref<AudioStreamWAV> looping_stream = make_sine_stream(0.5, true);
+	LocalVector<Ref<AudioStreamPlayback>> playbacks;
+
+	SUBCASE("Voices below the audibility threshold are virtual") {
+		playbacks.push_back(start_playback(looping_stream, 0.0));
+		playbacks.push_back(start_playback(looping_stream, -80.0));
+		TestAudioServerInternalsAccessor::mix_steps(1);
+		CHECK_FALSE(TestAudioServerInternalsAccessor::is_virtual(playbacks[0]));
+		CHECK(TestAudioServerInternalsAccessor::is_virtual(playbacks[1]));
+		CHECK(audio_server->get_real_voice_count() == 1);
+		CHECK(audio_server->get_virtual_voice_count() == 1);
+
+		// Just above the threshold, within the hysteresis margin.
+		audio_server->set_playback_bus_exclusive(playbacks[1], SNAME("Master"), bus_volumes(-59.0));
+		TestAudioServerInternalsAccessor::mix_steps(hold_mixes);
+		CHECK(TestAudioServerInternalsAccessor::is_virtual(playbacks[1]));
+
+		audio_server->set_playback_bus_exclusive(playbacks[1], SNAME("Master"), bus_volumes(-50.0));
+		TestAudioServerInternalsAccessor::mix_steps(1);
+		CHECK_FALSE(TestAudioServerInternalsAccessor::is_virtual(playbacks[1]));
+		CHECK(audio_server->get_real_voice_count() == 2);
+		CHECK(audio_server->get_virtual_voice_count() == 0);
+
+		// Voices that aren't playing anymore aren't counted.
+		audio_server->stop_playback_stream(playbacks[0]);
+		audio_server->set_playback_paused(playbacks[1], true);
+		TestAudioServerInternalsAccessor::mix_steps(1);
+		CHECK(audio_server->get_real_voice_count() == 0);
+		CHECK(audio_server->get_virtual_voice_count() == 0);
+	}
+
+	SUBCASE("The quietest voices over the budget are virtual") {
+		TestAudioServerInternalsAccessor::set_voice_virtualization(true, -60.0, 2);
+		playbacks.push_back(start_playback(looping_stream, 0.0));
+		playbacks.push_back(start_playback(looping_stream, -6.0));
+		playbacks.push_back(start_playback(looping_stream, -12.0));
+		TestAudioServerInternalsAccessor::mix_steps(1);
+		CHECK(TestAudioServerInternalsAccessor::is_virtual(playbacks[2]));
+		CHECK(audio_server->get_real_voice_count() == 2);
+		CHECK(audio_server->get_virtual_voice_count() == 1);
+
+		// Slightly louder than a real voice, within the hysteresis margin.
+		audio_server->set_playback_bus_exclusive(playbacks[2], SNAME("Master"), bus_volumes(-5.0));
+		TestAudioServerInternalsAccessor::mix_steps(hold_mixes);
+		CHECK(TestAudioServerInternalsAccessor::is_virtual(playbacks[2]));
+
+		audio_server->set_playback_bus_exclusive(playbacks[2], SNAME("Master"), bus_volumes(-1.0));
+		TestAudioServerInternalsAccessor::mix_steps(1);
+		CHECK_FALSE(TestAudioServerInternalsAccessor::is_virtual(playbacks[2]));
+		CHECK(TestAudioServerInternalsAccessor::is_virtual(playbacks[1]));
+		CHECK(audio_server->get_real_voice_count() == 2);
+		CHECK(audio_server->get_virtual_voice_count() == 1);
+	}
+
+	SUBCASE("A virtual voice keeps playing until its stream ends") {
+		Ref<AudioStreamWAV> stream = make_sine_stream(0.1, false);
+		playbacks.push_back(start_playback(stream, -80.0));
+		TestAudioServerInternalsAccessor::mix_steps(1);
+		CHECK(TestAudioServerInternalsAccessor::is_virtual(playbacks[0]));
+		CHECK(audio_server->is_playback_active(playbacks[0]));
+
+		TestAudioServerInternalsAccessor::mix_steps(hold_mixes);
+		CHECK_FALSE(audio_server->is_playback_active(playbacks[0]));
+		CHECK_FALSE(playbacks[0]->is_playing());
+		CHECK(audio_server->get_virtual_voice_count() == 0);
+	}
+
+	for (const Ref<AudioStreamPlayback> &playback : playbacks) {
+		audio_server->stop_playback_stream(playback);
+	}
+	TestAudioServerInternalsAccessor::mix_steps(1);
+	TestAudioServerInternalsAccessor::set_voice_virtualization(false, -60.0, 0);
+	audio_server->unlock();
+}
+
+} // namespace TestAudioServer
+
+#endif // TEST_AUDIO_SERVER_H